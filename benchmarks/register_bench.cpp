@@ -0,0 +1,91 @@
+/**
+ * @file register_bench.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Benchmarks for register.h
+ */
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <hv/common.h>
+
+#include "register/register.h"
+
+using namespace ::hv::common;
+using namespace ::hv::reg;
+
+namespace {
+
+void registerCallbacks(Register &reg) {
+	reg.registerPreReadCallback([](const RegisterReadEvent&) {return true;});
+	reg.registerPostReadCallback([](const RegisterReadEvent&) {});
+	reg.registerPreWriteCallback([](const RegisterWriteEvent&) {return true;});
+	reg.registerPostWriteCallback([](const RegisterWriteEvent&) {});
+}
+
+}
+
+// Register size in bits is given as argument
+static void BM_RegisterReadRaw(benchmark::State &state) {
+	Register reg(state.range(0), "Reg", "", RW, 0x5Au);
+	std::vector<hvuint8_t> buff(reg.getSizeInBytes());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(reg.read(buff.data(), buff.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * buff.size());
+}
+BENCHMARK(BM_RegisterReadRaw)->Arg(8)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_RegisterWriteRaw(benchmark::State &state) {
+	Register reg(state.range(0), "Reg", "", RW, 0u);
+	std::vector<hvuint8_t> buff(reg.getSizeInBytes(), 0xA5u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(reg.write(buff.data(), buff.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * buff.size());
+}
+BENCHMARK(BM_RegisterWriteRaw)->Arg(8)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_RegisterReadRawWithCallbacks(benchmark::State &state) {
+	Register reg(state.range(0), "Reg", "", RW, 0x5Au);
+	registerCallbacks(reg);
+	std::vector<hvuint8_t> buff(reg.getSizeInBytes());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(reg.read(buff.data(), buff.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * buff.size());
+}
+BENCHMARK(BM_RegisterReadRawWithCallbacks)->Arg(32)->Arg(128);
+
+static void BM_RegisterWriteRawWithCallbacks(benchmark::State &state) {
+	Register reg(state.range(0), "Reg", "", RW, 0u);
+	registerCallbacks(reg);
+	std::vector<hvuint8_t> buff(reg.getSizeInBytes(), 0xA5u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(reg.write(buff.data(), buff.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * buff.size());
+}
+BENCHMARK(BM_RegisterWriteRawWithCallbacks)->Arg(32)->Arg(128);
+
+static void BM_RegisterReadBitVector(benchmark::State &state) {
+	Register reg(state.range(0), "Reg", "", RW, 0x5Au);
+	BitVector dest(state.range(0), 0u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(reg.read(dest));
+	}
+	state.SetBytesProcessed(state.iterations() * reg.getSizeInBytes());
+}
+BENCHMARK(BM_RegisterReadBitVector)->Arg(8)->Arg(32)->Arg(64)->Arg(128);
+
+static void BM_RegisterWriteBitVector(benchmark::State &state) {
+	Register reg(state.range(0), "Reg", "", RW, 0u);
+	BitVector src(state.range(0), 0xA5u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(reg.write(src));
+	}
+	state.SetBytesProcessed(state.iterations() * reg.getSizeInBytes());
+}
+BENCHMARK(BM_RegisterWriteBitVector)->Arg(8)->Arg(32)->Arg(64)->Arg(128);
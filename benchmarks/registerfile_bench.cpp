@@ -0,0 +1,61 @@
+/**
+ * @file registerfile_bench.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Benchmarks for registerfile.h
+ */
+
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <hv/common.h>
+
+#include "registerfile/registerfile.h"
+
+using namespace ::hv::common;
+using namespace ::hv::reg;
+
+// Number of registers in register file is given as argument
+static void BM_RegisterFileGetRegisterByAddress(benchmark::State &state) {
+	const std::size_t nRegs(state.range(0));
+	RegisterFile rf("RegFile", "", 4);
+	rf.createRegisterBlock(0x0, nRegs, 32, "Reg", "", RW, 0u);
+	hvaddr_t addr(0u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(&rf.getRegister(addr));
+		addr = (addr + 4u) % (nRegs * 4u);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RegisterFileGetRegisterByAddress)->RangeMultiplier(8)->Range(8, 32768);
+
+static void BM_RegisterFileGetRegisterByName(benchmark::State &state) {
+	const std::size_t nRegs(state.range(0));
+	RegisterFile rf("RegFile", "", 4);
+	rf.createRegisterBlock(0x0, nRegs, 32, "Reg", "", RW, 0u);
+	std::vector<std::string> names;
+	for (std::size_t i = 0; i < nRegs; i++) {
+		names.push_back("Reg_" + std::to_string(i));
+	}
+	std::size_t ind(0u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(&rf.getRegister(names[ind]));
+		ind = (ind + 1u) % nRegs;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RegisterFileGetRegisterByName)->RangeMultiplier(8)->Range(8, 4096);
+
+static void BM_RegisterFileCreateRegisterBlock(benchmark::State &state) {
+	const std::size_t nRegs(state.range(0));
+	for (auto _ : state) {
+		RegisterFile rf("RegFile", "", 4);
+		benchmark::DoNotOptimize(
+				rf.createRegisterBlock(0x0, nRegs, 32, "Reg", "", RW, 0u));
+	}
+	state.SetItemsProcessed(state.iterations() * nRegs);
+	state.SetComplexityN(nRegs);
+}
+BENCHMARK(BM_RegisterFileCreateRegisterBlock)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
@@ -0,0 +1,147 @@
+/**
+ * @file registerfile_generator_bench.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Scaling benchmarks on synthetic register maps
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <hv/common.h>
+
+#include "registerfile/registerfile_generator.h"
+
+using namespace ::hv::common;
+using namespace ::hv::reg;
+
+namespace {
+
+/**
+ * Bytes currently allocated by the benchmark executable
+ */
+std::atomic<std::size_t> allocatedBytes(0u);
+
+/**
+ * Map parameters for a given number of registers per file and depth.
+ * Fan-out is 8 so that depth 0, 1, 2, 3 give 1, 9, 73 and 585 register files.
+ */
+RegisterMapGeneratorConfig makeConfig(const std::size_t &registersPerFile,
+		const std::size_t &depth) {
+	RegisterMapGeneratorConfig cfg;
+	cfg.depth = depth;
+	cfg.fanOut = 8u;
+	cfg.registersPerFile = registersPerFile;
+	cfg.registerWidths = {32, 32, 8, 16, 64};
+	cfg.alignment = 4u;
+	cfg.fieldDensity = 0.25;
+	cfg.callbackDensity = 0.1;
+	return cfg;
+}
+
+}
+
+// Allocation accounting to measure memory per register
+void* operator new(std::size_t size) {
+	std::size_t* p = static_cast<std::size_t*>(std::malloc(size + sizeof(std::max_align_t)));
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+	*p = size;
+	allocatedBytes += size;
+	return reinterpret_cast<char*>(p) + sizeof(std::max_align_t);
+}
+
+void operator delete(void* ptr) noexcept {
+	if (ptr == nullptr) {
+		return;
+	}
+	std::size_t* p = reinterpret_cast<std::size_t*>(static_cast<char*>(ptr)
+			- sizeof(std::max_align_t));
+	allocatedBytes -= *p;
+	std::free(p);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	::operator delete(ptr);
+}
+
+/**
+ * Synthetic register map fixture
+ *
+ * Arguments: registers per register file, depth.
+ * Generated maps are kept between runs since large ones take seconds to build.
+ */
+class RegisterMapFixture: public benchmark::Fixture {
+public:
+	void SetUp(const benchmark::State &state) override {
+		std::pair<std::size_t, std::size_t> key(state.range(0), state.range(1));
+		std::unique_ptr<RegisterMapGenerator> &gen = maps()[key];
+		if (!gen) {
+			gen.reset(new RegisterMapGenerator(makeConfig(key.first, key.second)));
+			gen->generate();
+		}
+		generator = gen.get();
+		addresses = generator->getAddresses();
+	}
+
+	void TearDown(const benchmark::State &) override {
+		addresses.clear();
+	}
+
+protected:
+	static std::map<std::pair<std::size_t, std::size_t>,
+			std::unique_ptr<RegisterMapGenerator> >& maps() {
+		static std::map<std::pair<std::size_t, std::size_t>,
+				std::unique_ptr<RegisterMapGenerator> > ret;
+		return ret;
+	}
+
+	RegisterMapGenerator *generator = nullptr;
+	std::vector<hvaddr_t> addresses;
+};
+
+// Decode latency: random accesses by address over the whole map
+BENCHMARK_DEFINE_F(RegisterMapFixture, DecodeByAddress)(benchmark::State &state) {
+	RegisterFile &root = generator->getRoot();
+	std::mt19937 rng(0u);
+	std::uniform_int_distribution<std::size_t> dist(0u, addresses.size() - 1u);
+	std::vector<hvaddr_t> sequence(4096u);
+	for (std::size_t i = 0; i < sequence.size(); i++) {
+		sequence[i] = addresses[dist(rng)];
+	}
+	std::size_t ind(0u);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(&root.getRegister(sequence[ind]));
+		ind = (ind + 1u) & (sequence.size() - 1u);
+	}
+	state.counters["registers"] = addresses.size();
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_REGISTER_F(RegisterMapFixture, DecodeByAddress)->Args( { 1000, 0 })->Args(
+		{ 100000, 0 })->Args( { 1000, 2 })->Args( { 1700, 3 });
+
+// Construction time and memory per register
+static void BM_RegisterMapGeneration(benchmark::State &state) {
+	const RegisterMapGeneratorConfig cfg(
+			makeConfig(state.range(0), state.range(1)));
+	std::size_t bytes(0u);
+	for (auto _ : state) {
+		const std::size_t before(allocatedBytes.load());
+		RegisterMapGenerator gen(cfg);
+		gen.generate();
+		bytes = allocatedBytes.load() - before;
+	}
+	state.counters["registers"] = cfg.getRegisterCount();
+	state.counters["bytesPerRegister"] = double(bytes) / cfg.getRegisterCount();
+	state.SetItemsProcessed(state.iterations() * cfg.getRegisterCount());
+}
+BENCHMARK(BM_RegisterMapGeneration)->Args( { 1000, 0 })->Args( { 100000, 0 })->Args(
+		{ 1000, 2 })->Args( { 1700, 3 })->Unit(benchmark::kMillisecond);
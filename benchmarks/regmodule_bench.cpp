@@ -0,0 +1,148 @@
+/**
+ * @file regmodule_bench.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Benchmarks for reg_module.h
+ */
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <hv/common.h>
+#include <systemc>
+
+#include "regmodule/reg_module.h"
+
+using namespace ::hv::common;
+using namespace ::hv::reg;
+using namespace ::hv::communication::tlm2::protocols::memorymapped;
+
+namespace {
+
+const std::size_t nRegs = 64u;
+
+class BenchRegModule: public RegModule<32> {
+public:
+	BenchRegModule(::hv::module::ModuleName name_) :
+			RegModule(name_, 4) {
+		mainRegisterFile.createRegisterBlock(0x0, nRegs, 32, "Reg", "", RW, 0u);
+	}
+};
+
+class BenchInitiator: public ::hv::module::Module {
+public:
+	BenchInitiator(::hv::module::ModuleName name_) :
+			::hv::module::Module(name_) {
+	}
+	MemoryMappedSimpleInitiatorSocket<> socket;
+};
+
+/**
+ * Modules are created once: SystemC does not allow creating modules with
+ * the same name for each benchmark run
+ */
+BenchRegModule& getTarget() {
+	static BenchRegModule target("BenchRegModule");
+	return target;
+}
+
+BenchInitiator& getInitiator() {
+	static BenchInitiator initiator("BenchInitiator");
+	static bool bound(false);
+	if (!bound) {
+		initiator.socket.bind(getTarget().memMapSocket);
+		bound = true;
+	}
+	return initiator;
+}
+
+}
+
+static void BM_RegModuleBTransportSingle(benchmark::State &state) {
+	BenchInitiator &initiator(getInitiator());
+	hvuint8_t buff[4] = { 0 };
+	::sc_core::sc_time delay(::sc_core::SC_ZERO_TIME);
+	MemoryMappedPayload<hvaddr_t> txn;
+	txn.setDataPtr(buff);
+	txn.setDataLength(4);
+	txn.setCommand(
+			state.range(0) ? MEM_MAP_WRITE_COMMAND : MEM_MAP_READ_COMMAND);
+	hvaddr_t addr(0u);
+	for (auto _ : state) {
+		txn.setAddress(addr);
+		initiator.socket->b_transport(txn, delay);
+		addr = (addr + 4u) % (nRegs * 4u);
+	}
+	state.SetBytesProcessed(state.iterations() * 4);
+}
+// Argument: 0 for reads, 1 for writes
+BENCHMARK(BM_RegModuleBTransportSingle)->Arg(0)->Arg(1);
+
+static void BM_RegModuleBTransportBurst(benchmark::State &state) {
+	BenchInitiator &initiator(getInitiator());
+	const std::size_t burstSize(state.range(0) * 4u);
+	std::vector<hvuint8_t> buff(burstSize);
+	::sc_core::sc_time delay(::sc_core::SC_ZERO_TIME);
+	MemoryMappedPayload<hvaddr_t> txn;
+	txn.setAddress(0x0);
+	txn.setDataPtr(buff.data());
+	txn.setDataLength(burstSize);
+	txn.setCommand(
+			state.range(1) ? MEM_MAP_WRITE_COMMAND : MEM_MAP_READ_COMMAND);
+	for (auto _ : state) {
+		initiator.socket->b_transport(txn, delay);
+	}
+	state.SetBytesProcessed(state.iterations() * burstSize);
+}
+// Arguments: number of registers per burst, 0 for reads, 1 for writes
+BENCHMARK(BM_RegModuleBTransportBurst)->Ranges( { { 4, 64 }, { 0, 1 } });
+
+static void BM_RegModuleBTransportPolling(benchmark::State &state) {
+	BenchInitiator &initiator(getInitiator());
+	BenchRegModule &target(getTarget());
+	hvuint8_t buff[4] = { 0 };
+	::sc_core::sc_time delay(::sc_core::SC_ZERO_TIME);
+	MemoryMappedPayload<hvaddr_t> txn;
+	txn.setDataPtr(buff);
+	txn.setDataLength(4);
+	txn.setCommand(MEM_MAP_READ_COMMAND);
+	const hvuint64_t hits(target.getDecodeCacheHits());
+	const hvuint64_t misses(target.getDecodeCacheMisses());
+	hvaddr_t addr(0u), walkAddr(0u);
+	std::size_t ind(0u);
+	for (auto _ : state) {
+		txn.setAddress(addr);
+		initiator.socket->b_transport(txn, delay);
+		// Status register polled, then the next register of a sequential walk
+		if (++ind % state.range(0)) {
+			addr = 0x0;
+		} else {
+			walkAddr = (walkAddr + 4u) % (nRegs * 4u);
+			addr = walkAddr;
+		}
+	}
+	state.counters["hitRatio"] = double(target.getDecodeCacheHits() - hits)
+			/ double(target.getDecodeCacheHits() - hits
+					+ target.getDecodeCacheMisses() - misses);
+	state.SetItemsProcessed(state.iterations());
+}
+// Argument: number of polls of the status register per sequential access
+BENCHMARK(BM_RegModuleBTransportPolling)->Arg(1)->Arg(8)->Arg(64);
+
+static void BM_RegModuleTransportDbg(benchmark::State &state) {
+	BenchInitiator &initiator(getInitiator());
+	const std::size_t burstSize(state.range(0) * 4u);
+	std::vector<hvuint8_t> buff(burstSize);
+	MemoryMappedPayload<hvaddr_t> txn;
+	txn.setAddress(0x0);
+	txn.setDataPtr(buff.data());
+	txn.setDataLength(burstSize);
+	txn.setCommand(MEM_MAP_READ_COMMAND);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(initiator.socket->transport_dbg(txn));
+	}
+	state.SetBytesProcessed(state.iterations() * burstSize);
+}
+// Argument: number of registers per debug read
+BENCHMARK(BM_RegModuleTransportDbg)->Range(4, 64);
@@ -0,0 +1,108 @@
+/**
+ * @file callback_worker_pool.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Worker pool running asynchronous callbacks
+ */
+
+#include "callback_worker_pool.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+CallbackWorkerPool::CallbackWorkerPool(const std::size_t &nThreads,
+		const std::size_t &maxPendingIn) :
+		maxPending(HV_MAX(maxPendingIn, std::size_t(1u))), pending(0u), completed(
+				0u), stopping(false) {
+	for (std::size_t i = 0; i < HV_MAX(nThreads, std::size_t(1u)); i++) {
+		workers.push_back(std::thread(&CallbackWorkerPool::workerLoop, this));
+	}
+}
+
+CallbackWorkerPool::~CallbackWorkerPool() {
+	this->waitIdle();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	readyCond.notify_all();
+	for (std::size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+}
+
+void CallbackWorkerPool::submit(const void *key, const task_type &task) {
+	std::unique_lock<std::mutex> lock(mutex);
+	// Backpressure: host memory stays bounded if callbacks are slower than simulation
+	doneCond.wait(lock, [this]() {return pending < maxPending;});
+	KeyQueue &queue(queues[key]);
+	queue.tasks.push_back(task);
+	pending++;
+	if (!queue.running && (queue.tasks.size() == 1u)) {
+		ready.push_back(key);
+		lock.unlock();
+		readyCond.notify_one();
+	}
+}
+
+void CallbackWorkerPool::waitIdle() {
+	std::unique_lock<std::mutex> lock(mutex);
+	doneCond.wait(lock, [this]() {return pending == 0u;});
+}
+
+void CallbackWorkerPool::waitIdle(const void *key) {
+	std::unique_lock<std::mutex> lock(mutex);
+	doneCond.wait(lock,
+			[this, key]() {return queues.find(key) == queues.end();});
+}
+
+std::size_t CallbackWorkerPool::howManyPending() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return pending;
+}
+
+hvuint64_t CallbackWorkerPool::getCompleted() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return completed;
+}
+
+std::size_t CallbackWorkerPool::getThreadCount() const {
+	return workers.size();
+}
+
+void CallbackWorkerPool::workerLoop() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		readyCond.wait(lock, [this]() {return stopping || !ready.empty();});
+		if (ready.empty()) {
+			return;
+		}
+		const void *key(ready.front());
+		ready.pop_front();
+		KeyQueue &queue(queues[key]);
+		task_type task(queue.tasks.front());
+		queue.tasks.pop_front();
+		queue.running = true;
+		lock.unlock();
+		task();
+		lock.lock();
+		// Queue reference is still valid: key is not erased while running
+		queue.running = false;
+		if (queue.tasks.empty()) {
+			queues.erase(key);
+		} else {
+			ready.push_back(key);
+			readyCond.notify_one();
+		}
+		pending--;
+		completed++;
+		doneCond.notify_all();
+	}
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,139 @@
+/**
+ * @file callback_worker_pool.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Worker pool running asynchronous callbacks
+ *
+ * Asynchronous post-read and post-write callbacks of registers attached to a
+ * pool (see Register::setCallbackWorkerPool() and
+ * RegisterFile::setCallbackWorkerPool()) run on pool threads instead of the
+ * SystemC thread. Tasks sharing a key (the register) run one at a time, in
+ * submission order. Tasks of different keys run in parallel.
+ */
+
+#ifndef HV_CALLBACK_WORKER_POOL_H_
+#define HV_CALLBACK_WORKER_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+class CallbackWorkerPool {
+public:
+	typedef std::function<void()> task_type;
+
+//** Constructors **//
+	/**
+	 * CallbackWorkerPool constructor
+	 * @param nThreads Number of worker threads (at least 1)
+	 * @param maxPendingIn Maximum number of submitted tasks not completed:
+	 * submit() blocks beyond
+	 */
+	CallbackWorkerPool(const std::size_t &nThreads,
+			const std::size_t &maxPendingIn = 1024u);
+
+	CallbackWorkerPool(const CallbackWorkerPool &) = delete;
+	CallbackWorkerPool& operator=(const CallbackWorkerPool &) = delete;
+
+//** Destructor **//
+	/**
+	 * CallbackWorkerPool destructor, waits for all submitted tasks
+	 */
+	virtual ~CallbackWorkerPool();
+
+//** Tasks **//
+	/**
+	 * Submit a task
+	 * @param key Ordering key: tasks of the same key never run concurrently
+	 * and run in submission order
+	 * @param task Task
+	 */
+	void submit(const void *key, const task_type &task);
+
+	/**
+	 * Wait for completion of all submitted tasks
+	 */
+	void waitIdle();
+
+	/**
+	 * Wait for completion of all submitted tasks of a key
+	 * @param key Ordering key
+	 */
+	void waitIdle(const void *key);
+
+	/**
+	 * Get number of submitted tasks not completed
+	 * @return Number of pending tasks
+	 */
+	std::size_t howManyPending() const;
+
+	/**
+	 * Get number of completed tasks since construction
+	 * @return Number of completed tasks
+	 */
+	::hv::common::hvuint64_t getCompleted() const;
+
+	std::size_t getThreadCount() const;
+
+protected:
+	/**
+	 * Worker thread loop
+	 */
+	void workerLoop();
+
+	/**
+	 * Tasks of a key, present while key has tasks not completed
+	 */
+	struct KeyQueue {
+		std::deque<task_type> tasks;
+
+		/**
+		 * true while a task of key is running
+		 */
+		bool running;
+	};
+
+	std::vector<std::thread> workers;
+
+	const std::size_t maxPending;
+
+	mutable std::mutex mutex;
+
+	/**
+	 * Signaled when a key becomes ready or pool stops
+	 */
+	std::condition_variable readyCond;
+
+	/**
+	 * Signaled when a task completes
+	 */
+	std::condition_variable doneCond;
+
+	std::unordered_map<const void*, KeyQueue> queues;
+
+	/**
+	 * Keys with tasks and no running task, in order of readiness
+	 */
+	std::deque<const void*> ready;
+
+	std::size_t pending;
+
+	::hv::common::hvuint64_t completed;
+
+	bool stopping;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_CALLBACK_WORKER_POOL_H_ */
@@ -0,0 +1,106 @@
+/**
+ * @file post_write_coalescer.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Coalescing of post-write notifications
+ */
+
+#include "post_write_coalescer.h"
+#include "register.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+PostWriteCoalescer::PostWriteCoalescer() :
+		depth(0u), flushing(false), coalescedWrites(0u) {
+}
+
+PostWriteCoalescer::~PostWriteCoalescer() {
+}
+
+void PostWriteCoalescer::beginBatch() {
+	depth++;
+}
+
+void PostWriteCoalescer::endBatch() {
+	if (depth == 0u) {
+		HV_WARN("Ending a post-write batch that was not begun")
+		return;
+	}
+	if (--depth == 0u) {
+		this->flush();
+	}
+}
+
+bool PostWriteCoalescer::isBatching() const {
+	return depth != 0u;
+}
+
+void PostWriteCoalescer::flush() {
+	// Flush requested by a callback is left to the running one
+	if (flushing) {
+		return;
+	}
+	flushing = true;
+	// Writes of callbacks are deferred to next round if a batch is open, and
+	// notified at once else
+	while (!pending.empty()) {
+		inFlight.clear();
+		inFlight.swap(pending);
+		pendingIndex.clear();
+		for (std::size_t i = 0; i < inFlight.size(); i++) {
+			// Cancelled by a callback of this round
+			if (inFlight[i].reg == nullptr) {
+				continue;
+			}
+			Register &reg(*inFlight[i].reg);
+			reg.runPostWriteNotifications(inFlight[i].oldVal, reg.data);
+		}
+	}
+	inFlight.clear();
+	flushing = false;
+}
+
+std::size_t PostWriteCoalescer::howManyPending() const {
+	return pending.size();
+}
+
+hvuint64_t PostWriteCoalescer::getCoalescedWrites() const {
+	return coalescedWrites;
+}
+
+void PostWriteCoalescer::defer(Register &reg, const BitVector &oldVal) {
+	if (pendingIndex.find(&reg) != pendingIndex.end()) {
+		// Oldest value is kept
+		coalescedWrites++;
+		return;
+	}
+	pendingIndex[&reg] = pending.size();
+	pending.push_back(Pending { &reg, oldVal });
+}
+
+void PostWriteCoalescer::cancel(const Register &reg) {
+	// Register may be waiting in round being delivered
+	for (std::size_t i = 0; i < inFlight.size(); i++) {
+		if (inFlight[i].reg == &reg) {
+			inFlight[i].reg = nullptr;
+		}
+	}
+	std::unordered_map<const Register*, std::size_t>::iterator it =
+			pendingIndex.find(&reg);
+	if (it == pendingIndex.end()) {
+		return;
+	}
+	pending.erase(pending.begin() + it->second);
+	pendingIndex.clear();
+	for (std::size_t i = 0; i < pending.size(); i++) {
+		pendingIndex[pending[i].reg] = i;
+	}
+}
+
+} // namespace reg
+} // namespace hv
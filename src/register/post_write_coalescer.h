@@ -0,0 +1,144 @@
+/**
+ * @file post_write_coalescer.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Coalescing of post-write notifications
+ *
+ * A coalescer attached to registers (see Register::setPostWriteCoalescer() and
+ * RegisterFile::setPostWriteCoalescer()) defers their post-write, change and
+ * CCI post-write callbacks while a batch is open. When the outermost batch
+ * ends, each written register is notified once, with its value before the
+ * first write of the batch as old value and its current value as new value.
+ * Out of batches, callbacks are called on each write as usual. Bank selection
+ * hooks are never deferred.
+ */
+
+#ifndef HV_POST_WRITE_COALESCER_H_
+#define HV_POST_WRITE_COALESCER_H_
+
+#include <unordered_map>
+#include <vector>
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+class Register;
+
+class PostWriteCoalescer {
+public:
+//** Constructors **//
+	PostWriteCoalescer();
+
+	PostWriteCoalescer(const PostWriteCoalescer &) = delete;
+	PostWriteCoalescer& operator=(const PostWriteCoalescer &) = delete;
+
+//** Destructor **//
+	/**
+	 * PostWriteCoalescer destructor
+	 *
+	 * Pending notifications are dropped. Coalescer must be detached from
+	 * registers before destruction.
+	 */
+	virtual ~PostWriteCoalescer();
+
+//** Batches **//
+	/**
+	 * Open a batch (batches can be nested)
+	 */
+	void beginBatch();
+
+	/**
+	 * Close a batch, delivering pending notifications if it is the outermost one
+	 */
+	void endBatch();
+
+	/**
+	 * Check if a batch is open
+	 * @return true if post-write notifications are deferred, false else
+	 */
+	bool isBatching() const;
+
+	/**
+	 * Deliver pending notifications, in order of first write
+	 *
+	 * Writes performed by callbacks are delivered after them, in the same call,
+	 * if a batch is open, and at once else. Registers may be destroyed or
+	 * detached by callbacks. A flush requested by a callback is left to the
+	 * running one.
+	 */
+	void flush();
+
+	/**
+	 * Get number of registers with a pending notification
+	 * @return Number of pending registers
+	 */
+	std::size_t howManyPending() const;
+
+	/**
+	 * Get number of writes whose notification was merged in a pending one
+	 * since construction
+	 * @return Number of coalesced writes
+	 */
+	::hv::common::hvuint64_t getCoalescedWrites() const;
+
+//** Register interface **//
+	/**
+	 * Defer post-write notification of a register (called by Register::write())
+	 * @param reg Written register
+	 * @param oldVal Register value before write
+	 */
+	void defer(Register &reg, const ::hv::common::BitVector &oldVal);
+
+	/**
+	 * Drop pending notification of a register, including one of the round
+	 * being delivered by flush()
+	 * @param reg Register
+	 */
+	void cancel(const Register &reg);
+
+protected:
+	/**
+	 * Pending notification
+	 */
+	struct Pending {
+		Register *reg;
+
+		/**
+		 * Register value before first write of batch
+		 */
+		::hv::common::BitVector oldVal;
+	};
+
+	std::vector<Pending> pending;
+
+	/**
+	 * Index register/position in pending
+	 */
+	std::unordered_map<const Register*, std::size_t> pendingIndex;
+
+	/**
+	 * Notifications of the round being delivered by flush() (reg is nullptr
+	 * once cancelled)
+	 */
+	std::vector<Pending> inFlight;
+
+	/**
+	 * Number of open batches
+	 */
+	std::size_t depth;
+
+	/**
+	 * true while flush() delivers notifications
+	 */
+	bool flushing;
+
+	::hv::common::hvuint64_t coalescedWrites;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_POST_WRITE_COALESCER_H_ */
@@ -17,14 +17,31 @@
 #include "../register/callback/register_callback_decl.h"
 #include "../register/register_cci.h"
 #include "../register/register_if.h"
+#include "../register/register_listener.h"
+#include "../register/register_selection.h"
+#include "../register/post_write_coalescer.h"
+#include "../register/callback_worker_pool.h"
 #include "../register/register.h"
+#include "../register/value_provider_register.h"
+#include "../registerfile/access_permission.h"
+#include "../registerfile/address_region.h"
+#include "../registerfile/range_callback_map.h"
+#include "../registerfile/register_array.h"
+#include "../registerfile/register_pattern.h"
 #include "../registerfile/registerfile_if.h"
 #include "../registerfile/registerfile.h"
+#include "../registerfile/registerfile_generator.h"
+#include "../registerfile/registerfile_observer.h"
+#include "../registerfile/registerfile_shared_memory.h"
+#include "../registerfile/sparse_memory_region.h"
+#include "../trace/access_trace_recorder.h"
+#include "../trace/access_trace_replayer.h"
 #include "../cci/register_callback_if.h"
 #include "../cci/register_if.h"
 #include "../cci/register_typed_handle.h"
 #include "../cci/register_untyped_handle.h"
 #include "../cci/register_untyped.h"
+#include "../regmodule/address_decoder.h"
 #include "../regmodule/reg_module.h"
 
 #endif // HV_REGISTER_REGISTER_PRIVATE_H
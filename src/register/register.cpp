@@ -8,6 +8,7 @@
  */
 
 #include "register.h"
+#include "../trace/access_trace_recorder.h"
 
 using namespace ::hv::common;
 
@@ -20,8 +21,9 @@ Register::Register(const std::size_t sizeIn, const std::string &nameIn,
 		name(nameIn), description(descriptionIn), mode(modeIn), data(sizeIn,
 				resetIn), resetVal(BitVector(sizeIn, resetIn)), readMask(sizeIn,
 				~BitVector(sizeIn, 0u)), writeMask(sizeIn,
-				~BitVector(sizeIn, 0u)), readLock(false), writeLock(false), cbIDCpt(
-				0u), regCCI(*this) {
+				~BitVector(sizeIn, 0u)), readLock(false), writeLock(false), changeWordMask(
+				0u), cbIDCpt(0u), accessCounters(nullptr), accessCountersIndex(0u), traceRecorder(nullptr), traceAddress(
+				0u), listener(nullptr), coalescer(nullptr), workerPool(nullptr), valueProvided(false), regCCI(*this) {
 	if (mode == RO) {
 		writeMask = 0u;
 	} else if (mode == WO) {
@@ -33,11 +35,22 @@ Register::Register(const Register& src) :
 		name(src.name), description(src.description), mode(src.mode), data(
 				src.data), resetVal(src.resetVal), readMask(src.readMask), writeMask(
 				src.writeMask), fields(src.fields), readLock(false), writeLock(
-				false), cbIDCpt(0u), regCCI(*this) {
-	// Warning - callbacks are not copied when copying registers
+				false), changeWordMask(0u), cbIDCpt(0u), accessCounters(nullptr), accessCountersIndex(0u), traceRecorder(
+				nullptr), traceAddress(0u), listener(nullptr), coalescer(nullptr), workerPool(nullptr), valueProvided(false), regCCI(*this) {
+	// Warning - callbacks, bank selection hooks, access counters, trace recorder, listener, coalescer and worker pool are not copied when copying registers
 }
 
 Register::~Register() {
+	if (listener) {
+		listener->onRegisterDestruction(*this);
+	}
+	if (coalescer) {
+		coalescer->cancel(*this);
+	}
+	// Pending callbacks may hold a reference to register
+	if (workerPool) {
+		workerPool->waitIdle(this);
+	}
 }
 
 std::size_t Register::getSize() const {
@@ -76,12 +89,17 @@ BitVector Register::getValue(const bool &applyReadMask) const {
 	return ret;
 }
 
+const void* Register::getDataAddress() const {
+	return data.getDataAddress();
+}
+
 void Register::setResetValue(const BitVector &resetIn) {
 	resetVal = resetIn;
 }
 
 void Register::setReadMask(const BitVector &readMaskVal) {
 	readMask = readMaskVal;
+	this->notifyAccessPolicyChange();
 }
 
 void Register::setWriteMask(const BitVector &writeMaskVal) {
@@ -97,21 +115,159 @@ void Register::setValue(const BitVector &src, const bool &applyWriteMask) {
 	} else {
 		data = src;
 	}
+	this->notifyValueChange();
 }
 
 void Register::reset() {
 	data = resetVal;
+	this->notifyValueChange();
+}
+
+void Register::setAccessCounters(
+		const std::shared_ptr<std::vector<RegisterAccessCounters> > &block,
+		const std::size_t &index) {
+	accessCounters = block;
+	accessCountersIndex = index;
+	this->notifyAccessPolicyChange();
+}
+
+RegisterAccessCounters* Register::getAccessCounters() const {
+	if (accessCounters == nullptr) {
+		return nullptr;
+	}
+	return &(*accessCounters)[accessCountersIndex];
+}
+
+void Register::setTraceRecorder(AccessTraceRecorder *recorder,
+		const hvaddr_t &address) {
+	traceRecorder = recorder;
+	traceAddress = address;
+	this->notifyAccessPolicyChange();
+}
+
+AccessTraceRecorder* Register::getTraceRecorder() const {
+	return traceRecorder;
+}
+
+void Register::setListener(RegisterListener *listenerIn) {
+	listener = listenerIn;
+}
+
+void Register::setPostWriteCoalescer(PostWriteCoalescer *coalescerIn) {
+	if (coalescer && (coalescer != coalescerIn)) {
+		coalescer->cancel(*this);
+	}
+	coalescer = coalescerIn;
+}
+
+PostWriteCoalescer* Register::getPostWriteCoalescer() const {
+	return coalescer;
+}
+
+void Register::setCallbackWorkerPool(CallbackWorkerPool *poolIn) {
+	if (workerPool && (workerPool != poolIn)) {
+		workerPool->waitIdle(this);
+	}
+	workerPool = poolIn;
+}
+
+CallbackWorkerPool* Register::getCallbackWorkerPool() const {
+	return workerPool;
+}
+
+RegisterListener* Register::getListener() const {
+	return listener;
+}
+
+void Register::notifyValueChange() {
+	if (listener) {
+		listener->onValueChange(*this);
+	}
+}
+
+void Register::notifyAccessPolicyChange() {
+	if (listener) {
+		listener->onAccessPolicyChange(*this);
+	}
+}
+
+bool Register::hasCallbacks() const {
+	return howManyCallbacks() || !changeCbVect.empty()
+			|| howManyAsyncCallbacks() || regCCI.hasCallbacks();
+}
+
+bool Register::isSideEffectFree() const {
+	return this->isWordAccessFree() && changeCbVect.empty();
+}
+
+bool Register::isWordAccessFree() const {
+	return !valueProvided && !this->hasAccessHooks();
+}
+
+bool Register::isValueProvided() const {
+	return valueProvided;
+}
+
+bool Register::hasAccessHooks() const {
+	return howManyCallbacks() || howManyAsyncCallbacks()
+			|| regCCI.hasCallbacks()
+#ifndef HV_REG_DISABLE_STATISTICS
+			|| (accessCounters != nullptr)
+#endif
+			|| (traceRecorder != nullptr) || !bankSelectHooks.empty();
+}
+
+hvcbID_t Register::addBankSelectHook(
+		const std::function<void(const Register&)> &hook) {
+	const hvcbID_t id(cbIDCpt++);
+	bankSelectHooks.push_back(std::make_pair(id, hook));
+	this->notifyAccessPolicyChange();
+	return id;
+}
+
+bool Register::removeBankSelectHook(const hvcbID_t &id) {
+	for (auto it = bankSelectHooks.begin(); it != bankSelectHooks.end(); ++it) {
+		if (it->first == id) {
+			bankSelectHooks.erase(it);
+			this->notifyAccessPolicyChange();
+			return true;
+		}
+	}
+	return false;
+}
+
+std::size_t Register::howManyBankSelectHooks() const {
+	return bankSelectHooks.size();
+}
+
+void Register::debugRead(hvuint8_t* readBuff,
+		const std::size_t &readSize) const {
+	std::memcpy(readBuff, data.getDataAddress(),
+			HV_MIN(readSize, this->getSizeInBytes()));
+}
+
+void Register::debugWrite(const hvuint8_t* writeBuff,
+		const std::size_t &writeSize) {
+	BitVector newVal(this->data);
+	std::memcpy(newVal.getDataAddress(), writeBuff,
+			HV_MIN(writeSize, this->getSizeInBytes()));
+	// Clearing bits beyond register size
+	newVal &= ~BitVector(this->getSize(), 0u);
+	this->data = newVal;
+	this->notifyValueChange();
 }
 
 bool Register::read(hvuint8_t* readBuff, const std::size_t &readSize) {
 	// We have to do this to avoid creating a cci event when there is no CCI callback registered
 	bool hasCCICallbacks = regCCI.hasCallbacks();
 	bool preReadOK(true);
+	// Value providers are called once per read and their value is not stored
+	BitVector value(this->getValue());
 
 	// Pre-read callbacks execution
 	if (!readLock) {
 		readLock = true;
-		BitVector evValue(this->data);
+		BitVector evValue(value);
 		RegisterReadEvent ev(evValue, *this);
 		preReadOK = this->runPreReadCallbacks(ev);
 		if (preReadOK && hasCCICallbacks) {
@@ -121,10 +277,26 @@ bool Register::read(hvuint8_t* readBuff, const std::size_t &readSize) {
 		}
 		readLock = false;
 	}
+#ifndef HV_REG_DISABLE_STATISTICS
+	if (accessCounters) {
+		RegisterAccessCounters &counters(
+				(*accessCounters)[accessCountersIndex]);
+		if (preReadOK) {
+			counters.reads++;
+			counters.bytesRead += readSize;
+		} else {
+			counters.readVetoes++;
+		}
+	}
+#endif
 	if (preReadOK) {
+		// Pre-read callbacks may have updated register data
+		if (!valueProvided) {
+			value = this->data;
+		}
 		// Reading
 		// Creating tmp variable for mask application
-		BitVector bvTmp(this->data);
+		BitVector bvTmp(value);
 		// Applying mask
 		bvTmp &= readMask;
 		void *tmp = std::memcpy(readBuff, bvTmp.getDataAddress(), readSize);
@@ -136,17 +308,26 @@ bool Register::read(hvuint8_t* readBuff, const std::size_t &readSize) {
 		// Post-read callbacks execution
 		if (!readLock) {
 			readLock = true;
-			BitVector evValue = this->data;
-			RegisterReadEvent ev(evValue, *this);
+			RegisterReadEvent ev(value, *this);
 			this->runPostReadCallbacks(ev);
+			if (!asyncPostReadCbVect.empty()) {
+				this->runAsyncPostReadCallbacks(ev);
+			}
 			if (hasCCICallbacks) {
 				::hv::hvcci::RegisterReadEvent<> cciEvent(
-						::cci::cci_value(evValue), regCCI);
+						::cci::cci_value(value), regCCI);
 				this->runPostReadCallbacks(ev);
 			}
 			readLock = false;
 		}
 	}
+	if (traceRecorder) {
+		traceRecorder->record(AccessTraceRecorder::now(), traceAddress,
+				preReadOK ? readBuff : nullptr, readSize,
+				AccessTraceRecord::READ,
+				preReadOK ? AccessTraceRecord::OK : AccessTraceRecord::VETOED,
+				AccessTraceRecord::REGISTER);
+	}
 	return preReadOK;
 }
 
@@ -185,24 +366,41 @@ bool Register::write(const hvuint8_t* writeBuff, const std::size_t &writeSize) {
 		writeLock = false;
 
 	}
+#ifndef HV_REG_DISABLE_STATISTICS
+	if (accessCounters) {
+		RegisterAccessCounters &counters(
+				(*accessCounters)[accessCountersIndex]);
+		if (preWriteOK) {
+			counters.writes++;
+			counters.bytesWritten += writeSize;
+		} else {
+			counters.writeVetoes++;
+		}
+	}
+#endif
 	if (preWriteOK) {
 		// Writing data
 		this->data = newVal;
-		// Post-write callbacks execution
-		// Note: write event can't have changed so we don't recreate it
+		this->notifyValueChange();
+		// Bank selection is never deferred
+		for (std::size_t i = 0; i < bankSelectHooks.size(); i++) {
+			bankSelectHooks[i].second(*this);
+		}
+		// Post-write callbacks execution, deferred in coalescer batches
 		if (!writeLock) {
-			writeLock = true;
-			RegisterWriteEvent ev(oldVal, newVal, *this);
-			this->runPostWriteCallbacks(ev);
-			if (hasCCICallbacks) {
-				::hv::hvcci::RegisterWriteEvent<> cciEvent(
-						::cci::cci_value(oldVal), ::cci::cci_value(newVal),
-						regCCI);
-				regCCI.runPostWriteCallbacks(cciEvent);
+			if (coalescer && coalescer->isBatching()) {
+				coalescer->defer(*this, oldVal);
+			} else {
+				this->runPostWriteNotifications(oldVal, newVal);
 			}
-			writeLock = false;
 		}
 	}
+	if (traceRecorder) {
+		traceRecorder->record(AccessTraceRecorder::now(), traceAddress,
+				writeBuff, writeSize, AccessTraceRecord::WRITE,
+				preWriteOK ? AccessTraceRecord::OK : AccessTraceRecord::VETOED,
+				AccessTraceRecord::REGISTER);
+	}
 	return preWriteOK;
 }
 
@@ -245,7 +443,7 @@ bool Register::write(const BitVector& src) {
 	return false;
 }
 
-#define HV_REG_CAST_TO(T) Register::operator T() const { return T(data); }
+#define HV_REG_CAST_TO(T) Register::operator T() const { return valueProvided ? T(this->getValue()) : T(data); }
 HV_REG_CAST_TO(bool)
 HV_REG_CAST_TO(hvuint8_t)
 HV_REG_CAST_TO(hvuint16_t)
@@ -257,7 +455,7 @@ HV_REG_CAST_TO(hvint32_t)
 HV_REG_CAST_TO(hvint64_t)
 HV_REG_CAST_TO(std::string)
 
-#define HV_REG_OPERATOR_EQUAL(T) Register& Register::operator =(const T &src) {data = src; return *this;}
+#define HV_REG_OPERATOR_EQUAL(T) Register& Register::operator =(const T &src) {data = src; this->notifyValueChange(); return *this;}
 HV_REG_OPERATOR_EQUAL(bool)
 HV_REG_OPERATOR_EQUAL(hvuint8_t)
 HV_REG_OPERATOR_EQUAL(hvuint16_t)
@@ -272,118 +470,175 @@ HV_REG_OPERATOR_EQUAL(std::string)
 
 Register& Register::operator =(const Register &src) {
 	data = src.data;
+	this->notifyValueChange();
 	return *this;
 }
 
 BitVector Register::operator <<(const hvuint32_t &nShift) const {
-	return data << nShift;
+	return valueProvided ? (this->getValue() << nShift) : (data << nShift);
 }
 
 BitVector Register::operator <<(const hvint32_t &nShift) const {
-	return data << nShift;
+	return valueProvided ? (this->getValue() << nShift) : (data << nShift);
 }
 
 BitVector Register::operator >>(const hvuint32_t &nShift) const {
-	return data >> nShift;
+	return valueProvided ? (this->getValue() >> nShift) : (data >> nShift);
 }
 
 BitVector Register::operator >>(const hvint32_t &nShift) const {
-	return data >> nShift;
+	return valueProvided ? (this->getValue() >> nShift) : (data >> nShift);
 }
 
 Register& Register::operator <<=(const hvuint32_t &nShift) {
 	data <<= nShift;
+	this->notifyValueChange();
 	return *this;
 }
 
 Register& Register::operator <<=(const hvint32_t &nShift) {
 	data <<= nShift;
+	this->notifyValueChange();
 	return *this;
 }
 
 Register& Register::operator >>=(const hvuint32_t &nShift) {
 	data >>= nShift;
+	this->notifyValueChange();
 	return *this;
 }
 
 Register& Register::operator >>=(const hvint32_t &nShift) {
 	data >>= nShift;
+	this->notifyValueChange();
 	return *this;
 }
 
 bool Register::operator !() const {
-	return !data;
+	return valueProvided ? !this->getValue() : !data;
 }
 
 bool Register::operator ==(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() == op2.getValue();
+	}
 	return data == op2.data;
 }
 
 bool Register::operator !=(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() != op2.getValue();
+	}
 	return data != op2.data;
 }
 
 bool Register::operator &&(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() && op2.getValue();
+	}
 	return data && op2.data;
 }
 
 bool Register::operator ||(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() || op2.getValue();
+	}
 	return data || op2.data;
 }
 
 BitVector Register::operator ~() const {
-	return ~data;
+	return valueProvided ? ~this->getValue() : ~data;
 }
 
 BitVector Register::operator &(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() & op2.getValue();
+	}
 	return data & op2.data;
 }
 
 BitVector Register::operator |(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() | op2.getValue();
+	}
 	return data | op2.data;
 }
 
 BitVector Register::operator ^(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() ^ op2.getValue();
+	}
 	return data ^ op2.data;
 }
 
 Register& Register::operator &=(const Register &op2) {
 	data &= op2.data;
+	this->notifyValueChange();
 	return *this;
 }
 
 Register& Register::operator |=(const Register &op2) {
 	data |= op2.data;
+	this->notifyValueChange();
 	return *this;
 }
 
 Register& Register::operator ^=(const Register &op2) {
 	data ^= op2.data;
+	this->notifyValueChange();
 	return *this;
 }
 
 BitVector Register::operator +(const Register &op2) const {
+	if (valueProvided || op2.valueProvided) {
+		return this->getValue() + op2.getValue();
+	}
 	return data + op2.data;
 }
 
 BitVector Register::operator ()(const std::size_t &ind1,
 		const std::size_t &ind2) {
+	if (valueProvided) {
+		const BitVector value(this->getValue());
+		return value(ind1, ind2);
+	}
 	return data(ind1, ind2);
 }
 
 BitVector Register::operator ()(const std::size_t &ind1,
 		const std::size_t &ind2) const {
+	if (valueProvided) {
+		const BitVector value(this->getValue());
+		return value(ind1, ind2);
+	}
 	return data(ind1, ind2);
 }
 
 BitVector Register::operator [](const std::size_t &ind) {
+	if (valueProvided) {
+		const BitVector value(this->getValue());
+		return value[ind];
+	}
 	return data[ind];
 }
 
 BitVector Register::operator [](const std::size_t &ind) const {
+	if (valueProvided) {
+		const BitVector value(this->getValue());
+		return value[ind];
+	}
 	return data[ind];
 }
 
+RegisterSelection Register::select(const std::size_t &ind1,
+		const std::size_t &ind2) {
+	return RegisterSelection(*this, ind1, ind2);
+}
+
+RegisterSelection Register::select(const std::size_t &ind) {
+	return RegisterSelection(*this, ind, ind);
+}
+
 void Register::createField(const std::string &fieldName,
 		const std::size_t &ind1, const std::size_t &ind2,
 		const std::string &fieldDescription, const hvrwmode_t &fieldRWMode) {
@@ -465,9 +720,23 @@ BitVector Register::operator ()(const std::string &fieldName) {
 		HV_ERR("Field does not exist")
 		exit(EXIT_FAILURE);
 	}
+	if (valueProvided) {
+		const BitVector value(this->getValue());
+		return value(indLow, indHigh);
+	}
 	return data(indLow, indHigh);
 }
 
+RegisterSelection Register::selectField(const std::string &fieldName) {
+	std::size_t indLow, indHigh;
+	hvrwmode_t RWmodeTmp;
+	if (!fields.get(fieldName, &indLow, &indHigh, &RWmodeTmp)) {
+		HV_ERR("Field does not exist")
+		exit(EXIT_FAILURE);
+	}
+	return RegisterSelection(*this, indLow, indHigh);
+}
+
 BitVector Register::operator ()(const std::string &fieldName) const {
 	std::size_t indLow, indHigh;
 	hvrwmode_t RWmodeTmp;
@@ -475,6 +744,10 @@ BitVector Register::operator ()(const std::string &fieldName) const {
 		HV_ERR("Field does not exist")
 		exit(EXIT_FAILURE);
 	}
+	if (valueProvided) {
+		const BitVector value(this->getValue());
+		return value(indLow, indHigh);
+	}
 	return data(indLow, indHigh);
 }
 
@@ -515,6 +788,7 @@ hvcbID_t Register::registerPreReadCallback(const PreReadCallback &cb) {
 	hvcbID_t idTmp = this->getUniqueID();
 	cbTmp.setId(idTmp);
 	preReadCbVect.push_back(cbTmp);
+	this->notifyAccessPolicyChange();
 	return idTmp;
 }
 
@@ -523,6 +797,7 @@ hvcbID_t Register::registerPostReadCallback(const PostReadCallback &cb) {
 	hvcbID_t idTmp = this->getUniqueID();
 	cbTmp.setId(idTmp);
 	postReadCbVect.push_back(cbTmp);
+	this->notifyAccessPolicyChange();
 	return idTmp;
 }
 
@@ -531,6 +806,7 @@ hvcbID_t Register::registerPreWriteCallback(const PreWriteCallback &cb) {
 	hvcbID_t idTmp = this->getUniqueID();
 	cbTmp.setId(idTmp);
 	preWriteCbVect.push_back(cbTmp);
+	this->notifyAccessPolicyChange();
 	return idTmp;
 }
 
@@ -539,6 +815,7 @@ hvcbID_t Register::registerPostWriteCallback(const PostWriteCallback &cb) {
 	hvcbID_t idTmp = this->getUniqueID();
 	cbTmp.setId(idTmp);
 	postWriteCbVect.push_back(cbTmp);
+	this->notifyAccessPolicyChange();
 	return idTmp;
 }
 
@@ -548,6 +825,7 @@ bool Register::unregisterPreReadCallback(const hvcbID_t &id) {
 		return false;
 	}
 	preReadCbVect.erase(it);
+	this->notifyAccessPolicyChange();
 	return true;
 }
 
@@ -557,6 +835,7 @@ bool Register::unregisterPostReadCallback(const hvcbID_t &id) {
 		return false;
 	}
 	postReadCbVect.erase(it);
+	this->notifyAccessPolicyChange();
 	return true;
 
 }
@@ -567,6 +846,7 @@ bool Register::unregisterPreWriteCallback(const hvcbID_t &id) {
 		return false;
 	}
 	preWriteCbVect.erase(it);
+	this->notifyAccessPolicyChange();
 	return true;
 }
 
@@ -576,6 +856,7 @@ bool Register::unregisterPostWriteCallback(const hvcbID_t &id) {
 		return false;
 	}
 	postWriteCbVect.erase(it);
+	this->notifyAccessPolicyChange();
 	return true;
 }
 
@@ -584,9 +865,105 @@ bool Register::unregisterAllCallbacks() {
 	postReadCbVect.clear();
 	preWriteCbVect.clear();
 	postWriteCbVect.clear();
+	changeCbVect.clear();
+	changeWordMask = 0u;
+	asyncPostReadCbVect.clear();
+	asyncPostWriteCbVect.clear();
+	this->notifyAccessPolicyChange();
+	return true;
+}
+
+hvcbID_t Register::registerChangeCallback(const BitVector &mask,
+		const PostWriteCallback &cb) {
+	ChangeCallback cbTmp = { BitVector(this->getSize(), mask), ~hvuint64_t(0u),
+			cb };
+	hvcbID_t idTmp = this->getUniqueID();
+	cbTmp.cb.setId(idTmp);
+	if (this->getSizeInBytes() <= sizeof(hvuint64_t)) {
+		cbTmp.wordMask = 0u;
+		std::memcpy(&cbTmp.wordMask, cbTmp.mask.getDataAddress(),
+				this->getSizeInBytes());
+	}
+	changeCbVect.push_back(cbTmp);
+	changeWordMask |= cbTmp.wordMask;
+	this->notifyAccessPolicyChange();
+	return idTmp;
+}
+
+hvcbID_t Register::registerFieldChangeCallback(const std::string &fieldName,
+		const PostWriteCallback &cb) {
+	std::pair<std::size_t, std::size_t> indexes(
+			this->getFieldIndexes(fieldName));
+	BitVector maskTmp(indexes.second - indexes.first + std::size_t(1u), 0u);
+	maskTmp = ~maskTmp;
+	BitVector mask(this->getSize(), maskTmp);
+	mask <<= static_cast<hvuint32_t>(indexes.first);
+	return this->registerChangeCallback(mask, cb);
+}
+
+bool Register::unregisterChangeCallback(const hvcbID_t &id) {
+	std::vector<ChangeCallback>::iterator it = changeCbVect.begin();
+	while ((it != changeCbVect.end()) && (it->cb.getId() != id)) {
+		++it;
+	}
+	if (it == changeCbVect.end()) {
+		return false;
+	}
+	changeCbVect.erase(it);
+	changeWordMask = 0u;
+	for (it = changeCbVect.begin(); it != changeCbVect.end(); ++it) {
+		changeWordMask |= it->wordMask;
+	}
+	this->notifyAccessPolicyChange();
 	return true;
 }
 
+std::size_t Register::howManyChangeCallbacks() const {
+	return changeCbVect.size();
+}
+
+hvcbID_t Register::registerAsyncPostReadCallback(const PostReadCallback &cb) {
+	PostReadCallback cbTmp(cb);
+	hvcbID_t idTmp = this->getUniqueID();
+	cbTmp.setId(idTmp);
+	asyncPostReadCbVect.push_back(cbTmp);
+	this->notifyAccessPolicyChange();
+	return idTmp;
+}
+
+hvcbID_t Register::registerAsyncPostWriteCallback(const PostWriteCallback &cb) {
+	PostWriteCallback cbTmp(cb);
+	hvcbID_t idTmp = this->getUniqueID();
+	cbTmp.setId(idTmp);
+	asyncPostWriteCbVect.push_back(cbTmp);
+	this->notifyAccessPolicyChange();
+	return idTmp;
+}
+
+bool Register::unregisterAsyncCallback(const hvcbID_t &id) {
+	for (PostReadCallbackVector::iterator it = asyncPostReadCbVect.begin();
+			it != asyncPostReadCbVect.end(); ++it) {
+		if (it->getId() == id) {
+			asyncPostReadCbVect.erase(it);
+			this->notifyAccessPolicyChange();
+			return true;
+		}
+	}
+	for (PostWriteCallbackVector::iterator it = asyncPostWriteCbVect.begin();
+			it != asyncPostWriteCbVect.end(); ++it) {
+		if (it->getId() == id) {
+			asyncPostWriteCbVect.erase(it);
+			this->notifyAccessPolicyChange();
+			return true;
+		}
+	}
+	return false;
+}
+
+std::size_t Register::howManyAsyncCallbacks() const {
+	return asyncPostReadCbVect.size() + asyncPostWriteCbVect.size();
+}
+
 bool Register::runPreReadCallbacks(const RegisterReadEvent& ev) {
 	for (auto it = this->preReadCbVect.begin(); it != this->preReadCbVect.end();
 			++it) {
@@ -617,6 +994,92 @@ void Register::runPostWriteCallbacks(const RegisterWriteEvent& ev) {
 	}
 }
 
+void Register::runAsyncPostReadCallbacks(const RegisterReadEvent& ev) {
+	for (auto it = asyncPostReadCbVect.begin(); it != asyncPostReadCbVect.end();
+			++it) {
+		if (!workerPool) {
+			(*it)(ev);
+			continue;
+		}
+		// Event is copied: simulation goes on while callback runs
+		PostReadCallback cb(*it);
+		RegisterReadEvent evTmp(ev);
+		workerPool->submit(this, [cb, evTmp]() mutable {cb(evTmp);});
+	}
+}
+
+void Register::runAsyncPostWriteCallbacks(const RegisterWriteEvent& ev) {
+	for (auto it = asyncPostWriteCbVect.begin();
+			it != asyncPostWriteCbVect.end(); ++it) {
+		if (!workerPool) {
+			(*it)(ev);
+			continue;
+		}
+		PostWriteCallback cb(*it);
+		RegisterWriteEvent evTmp(ev);
+		workerPool->submit(this, [cb, evTmp]() mutable {cb(evTmp);});
+	}
+}
+
+void Register::runPostWriteNotifications(const BitVector &oldVal,
+		const BitVector &newVal) {
+	// Coalescer may deliver notifications from a callback of this register
+	const bool writeLockTmp(writeLock);
+	writeLock = true;
+	RegisterWriteEvent ev(oldVal, newVal, *this);
+	this->runPostWriteCallbacks(ev);
+	if (!asyncPostWriteCbVect.empty()) {
+		this->runAsyncPostWriteCallbacks(ev);
+	}
+	if (regCCI.hasCallbacks()) {
+		::hv::hvcci::RegisterWriteEvent<> cciEvent(::cci::cci_value(oldVal),
+				::cci::cci_value(newVal), regCCI);
+		regCCI.runPostWriteCallbacks(cciEvent);
+	}
+	if (!changeCbVect.empty()) {
+		this->runChangeCallbacks(oldVal, newVal);
+	}
+	writeLock = writeLockTmp;
+}
+
+void Register::runChangeCallbacks(const BitVector &oldVal,
+		const BitVector &newVal) {
+	const std::size_t size(this->getSizeInBytes());
+	const hvuint8_t *oldData(
+			static_cast<const hvuint8_t*>(oldVal.getDataAddress()));
+	const hvuint8_t *newData(
+			static_cast<const hvuint8_t*>(newVal.getDataAddress()));
+	hvuint64_t diff(~hvuint64_t(0u));
+	if (size <= sizeof(hvuint64_t)) {
+		hvuint64_t oldWord(0u), newWord(0u);
+		std::memcpy(&oldWord, oldData, size);
+		std::memcpy(&newWord, newData, size);
+		diff = oldWord ^ newWord;
+		if (!(diff & changeWordMask)) {
+			return;
+		}
+	}
+	// Event is only built if a callback is called
+	std::unique_ptr<RegisterWriteEvent> ev;
+	for (auto it = changeCbVect.begin(); it != changeCbVect.end(); ++it) {
+		bool changed(diff & it->wordMask);
+		if (size > sizeof(hvuint64_t)) {
+			const hvuint8_t *maskData(
+					static_cast<const hvuint8_t*>(it->mask.getDataAddress()));
+			changed = false;
+			for (std::size_t i = 0; (i < size) && !changed; i++) {
+				changed = (oldData[i] ^ newData[i]) & maskData[i];
+			}
+		}
+		if (changed) {
+			if (!ev) {
+				ev.reset(new RegisterWriteEvent(oldVal, newVal, *this));
+			}
+			it->cb(*ev);
+		}
+	}
+}
+
 Register::PreReadCallbackVector::iterator Register::getPreReadCallbackIt(
 		const hvcbID_t &id) {
 	for (PreReadCallbackVector::iterator it = preReadCbVect.begin();
@@ -708,8 +1171,9 @@ std::string Register::getInfo(hvuint32_t level) const {
 		tmp << this->getRegTable() << std::endl;
 
 		tmp << "#### Register value ####" << std::endl;
-		tmp << "\tBin: " << data.toString() << std::endl;
-		tmp << "\tHex: " << binStrToHexaStr(data.toString()) << std::endl
+		const BitVector value(this->getValue());
+		tmp << "\tBin: " << value.toString() << std::endl;
+		tmp << "\tHex: " << binStrToHexaStr(value.toString()) << std::endl
 				<< std::endl;
 
 		tmp << "#### Fields details ####" << std::endl;
@@ -818,7 +1282,7 @@ std::string Register::getRegTable() const {
 }
 
 std::string Register::toString() const {
-	return data.toString();
+	return valueProvided ? this->getValue().toString() : data.toString();
 }
 
 std::ostream& operator <<(std::ostream &strm, const Register &reg) {
@@ -13,22 +13,33 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <cstring>
 #include <vector>
+#include <memory>
 #include <hv/common.h>
 
 #include "register_if.h"
 #include "callback/register_callback_if.h"
 #include "register_cci.h"
+#include "register_access_counters.h"
+#include "register_listener.h"
+#include "register_selection.h"
+#include "post_write_coalescer.h"
+#include "callback_worker_pool.h"
 #include "field/fields.h"
 
 namespace hv {
 namespace reg {
 
+class AccessTraceRecorder;
+
 /**
  * Register class
  */
 class Register: public RegisterIf, public RegisterCallbackIf {
 	friend class RegisterCCI;
+	friend class PostWriteCoalescer;
+	friend class RegisterSelection;
 public:
 //** Type definitions **//
 	typedef std::vector<PreReadCallback> PreReadCallbackVector;
@@ -112,6 +123,16 @@ public:
 	::hv::common::BitVector getValue(const bool &applyReadMask = false) const
 			override;
 
+	/**
+	 * Get address of raw register data
+	 *
+	 * Data is stored LSB first on getSizeInBytes() bytes. This accessor
+	 * is meant for tools mirroring register values (observers, exporters),
+	 * not for modifying the register.
+	 * @return Address of raw register data
+	 */
+	const void* getDataAddress() const;
+
 //** Modifiers **//
 	/**
 	 * Set reset value
@@ -155,6 +176,179 @@ public:
 	 */
 	void reset();
 
+//** Access statistics **//
+	/**
+	 * Attach access counters to register
+	 *
+	 * Counters are updated by read() and write(). They are an element of a
+	 * block whose ownership register shares, so that they outlive it or the
+	 * register file which attached them, whichever is destroyed first.
+	 * @param block Block of counters, nullptr to detach
+	 * @param index Index of counters of register in block
+	 */
+	void setAccessCounters(
+			const std::shared_ptr<std::vector<RegisterAccessCounters> > &block,
+			const std::size_t &index = 0u);
+
+	/**
+	 * Get attached access counters
+	 * @return Attached counters, nullptr if none
+	 */
+	RegisterAccessCounters* getAccessCounters() const;
+
+//** Access trace **//
+	/**
+	 * Attach trace recorder to register
+	 *
+	 * Every read() and write() is recorded. Register does not own the recorder.
+	 * @param recorder Trace recorder, nullptr to detach
+	 * @param address Address recorded for this register
+	 */
+	void setTraceRecorder(AccessTraceRecorder *recorder,
+			const ::hv::common::hvaddr_t &address = 0u);
+
+	/**
+	 * Get attached trace recorder
+	 * @return Attached recorder, nullptr if none
+	 */
+	AccessTraceRecorder* getTraceRecorder() const;
+
+//** Post-write coalescing **//
+	/**
+	 * Attach post-write coalescer to register
+	 *
+	 * While a batch of coalescer is open, post-write notifications of
+	 * write() are deferred to the end of the batch. Register does not own
+	 * the coalescer.
+	 * @param coalescerIn Coalescer, nullptr to detach
+	 */
+	void setPostWriteCoalescer(PostWriteCoalescer *coalescerIn);
+
+	/**
+	 * Get attached post-write coalescer
+	 * @return Attached coalescer, nullptr if none
+	 */
+	PostWriteCoalescer* getPostWriteCoalescer() const;
+
+//** Asynchronous callbacks **//
+	/**
+	 * Attach worker pool running asynchronous callbacks of register
+	 *
+	 * Without worker pool, asynchronous callbacks are called synchronously.
+	 * Register does not own the pool.
+	 * @param poolIn Worker pool, nullptr to detach
+	 */
+	void setCallbackWorkerPool(CallbackWorkerPool *poolIn);
+
+	/**
+	 * Get attached worker pool
+	 * @return Attached worker pool, nullptr if none
+	 */
+	CallbackWorkerPool* getCallbackWorkerPool() const;
+
+//** Change listener **//
+	/**
+	 * Attach change listener to register
+	 *
+	 * Register does not own the listener.
+	 * @param listenerIn Listener, nullptr to detach
+	 */
+	void setListener(RegisterListener *listenerIn);
+
+	/**
+	 * Get attached change listener
+	 * @return Attached listener, nullptr if none
+	 */
+	RegisterListener* getListener() const;
+
+	/**
+	 * Notify listener of a value change
+	 *
+	 * Called by all register modifiers, including assignments to handles
+	 * returned by select() and selectField(). Must be called by user after
+	 * modifying register through operator ()() or operator [].
+	 */
+	void notifyValueChange();
+
+//** Bank selection hooks **//
+	/**
+	 * Add a bank selection hook
+	 *
+	 * Hooks are called synchronously after each successful write(). Unlike
+	 * post-write callbacks, they are never deferred by a coalescer and are not
+	 * removed by unregisterCallback() or unregisterAllCallbacks(). Used by
+	 * RegisterFile::setBankSelector().
+	 * @param hook Hook, called with written register
+	 * @return Hook ID
+	 */
+	::hv::common::hvcbID_t addBankSelectHook(
+			const std::function<void(const Register&)> &hook);
+
+	/**
+	 * Remove a bank selection hook
+	 * @param id Hook ID
+	 * @return true if hook was found, false else
+	 */
+	bool removeBankSelectHook(const ::hv::common::hvcbID_t &id);
+
+	/**
+	 * Get number of bank selection hooks
+	 * @return Number of hooks
+	 */
+	std::size_t howManyBankSelectHooks() const;
+
+	/**
+	 * Check if register has Hiventive, change or CCI callbacks
+	 * @return true if at least one callback is registered, false else
+	 */
+	bool hasCallbacks() const;
+
+	/**
+	 * Check if read() and write() have no side effect besides value update
+	 * @return true if register has no callbacks, access counters or trace
+	 * recorder and its value is stored
+	 */
+	bool isSideEffectFree() const;
+
+	/**
+	 * Check if word accesses can be reduced to masked word copies, change
+	 * callbacks being dispatched by writeWord()
+	 * @return true if register has no callbacks but change callbacks, no
+	 * access counters, no trace recorder and its value is stored
+	 */
+	bool isWordAccessFree() const;
+
+	/**
+	 * Check if register value is computed on demand instead of stored (see
+	 * ValueProviderRegister)
+	 *
+	 * Data address of such registers holds the last value read, tools
+	 * mirroring register values must use debugRead().
+	 * @return true if value is computed on demand
+	 */
+	bool isValueProvided() const;
+
+//** Debug access **//
+	/**
+	 * Read register data without side effects
+	 *
+	 * Callbacks, read mask, access statistics and trace are bypassed.
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes (truncated to register size in bytes)
+	 */
+	virtual void debugRead(::hv::common::hvuint8_t* readBuff,
+			const std::size_t &readSize) const;
+
+	/**
+	 * Write register data without side effects
+	 *
+	 * Callbacks, write mask, access statistics and trace are bypassed.
+	 * @param writeBuff Write buffer
+	 * @param writeSize Write size in bytes (truncated to register size in bytes)
+	 */
+	void debugWrite(const ::hv::common::hvuint8_t* writeBuff,
+			const std::size_t &writeSize);
+
 //** Read/Write **//
 	/**
 	 * Read data from register
@@ -174,6 +368,59 @@ public:
 	bool write(const ::hv::common::hvuint8_t* writeBuff,
 			const std::size_t &writeSize) override;
 
+	/**
+	 * Read data from register as one native word
+	 *
+	 * Equivalent to read(readBuff, sizeof(T)), reduced to a masked word copy
+	 * when register is side-effect free. sizeof(T) must be register size in bytes.
+	 * @param readBuff Read buffer
+	 * @return true if success
+	 */
+	template<typename T> bool readWord(::hv::common::hvuint8_t* readBuff) {
+		if (!this->isWordAccessFree()) {
+			return this->read(readBuff, sizeof(T));
+		}
+		T value, mask;
+		std::memcpy(&value, data.getDataAddress(), sizeof(T));
+		std::memcpy(&mask, readMask.getDataAddress(), sizeof(T));
+		value = static_cast<T>(value & mask);
+		std::memcpy(readBuff, &value, sizeof(T));
+		return true;
+	}
+
+	/**
+	 * Write data to register as one native word
+	 *
+	 * Equivalent to write(writeBuff, sizeof(T)), reduced to a masked word copy
+	 * when register is side-effect free. sizeof(T) must be register size in bytes.
+	 * Change callbacks are only called if a watched bit changed.
+	 * @param writeBuff Write buffer
+	 * @return true if success
+	 */
+	template<typename T> bool writeWord(const ::hv::common::hvuint8_t* writeBuff) {
+		if (!this->isWordAccessFree()
+				|| ((coalescer != nullptr) && !changeCbVect.empty())) {
+			return this->write(writeBuff, sizeof(T));
+		}
+		T value, src, mask;
+		std::memcpy(&value, data.getDataAddress(), sizeof(T));
+		std::memcpy(&src, writeBuff, sizeof(T));
+		std::memcpy(&mask, writeMask.getDataAddress(), sizeof(T));
+		const T oldValue(value);
+		value = static_cast<T>((value & ~mask) | (src & mask));
+		std::memcpy(data.getDataAddress(), &value, sizeof(T));
+		this->notifyValueChange();
+		if (!writeLock
+				&& (static_cast<::hv::common::hvuint64_t>(oldValue ^ value)
+						& changeWordMask)) {
+			writeLock = true;
+			this->runChangeCallbacks(
+					::hv::common::BitVector(this->getSize(), oldValue), data);
+			writeLock = false;
+		}
+		return true;
+	}
+
 	/**
 	 * Read from register and store in BitVector
 	 * @param dest Destination BitVector address
@@ -492,6 +739,8 @@ public:
 	 * If reg is a register, then reg(ind1, ind2) selects the bits
 	 * between indexes ind1 and ind2. the order of ind1 and ind2 is
 	 * not important.
+	 * Writes through the returned BitVector are not notified to the register
+	 * listener: see select().
 	 * @param ind1 First index (LSB, resp. MSB of selection)
 	 * @param ind2 Second index (MSB, resp. LSB of selection)
 	 * @return BitVector representing selected vector
@@ -527,6 +776,24 @@ public:
 	 */
 	::hv::common::BitVector operator [](const std::size_t &ind) const override;
 
+	/**
+	 * Vector selection notifying value changes
+	 *
+	 * Unlike operator ()(), assigning the returned handle notifies the register
+	 * listener, e.g. so that DMI images of RegModule follow model code.
+	 * @param ind1 First index (LSB, resp. MSB of selection)
+	 * @param ind2 Second index (MSB, resp. LSB of selection)
+	 * @return Handle to selected vector
+	 */
+	RegisterSelection select(const std::size_t &ind1, const std::size_t &ind2);
+
+	/**
+	 * Bit selection notifying value changes
+	 * @param ind Index of the bit to be selected
+	 * @return Handle to selected bit
+	 */
+	RegisterSelection select(const std::size_t &ind);
+
 //** Field manipulation **//
 	/**
 	 * Create field in register
@@ -589,6 +856,13 @@ public:
 	 */
 	::hv::common::BitVector operator ()(const std::string &fieldName) override;
 
+	/**
+	 * Field selection notifying value changes (see select())
+	 * @param fieldName Field name
+	 * @return Handle to field
+	 */
+	RegisterSelection selectField(const std::string &fieldName);
+
 	/**
 	 * Get field value - const version
 	 * @param fieldName Field name
@@ -677,11 +951,92 @@ public:
 	bool unregisterAllCallbacks() override;
 	// End Hiventive callbacks
 
+	// Change callbacks
+	/**
+	 * Register a callback called after writes modifying watched bits
+	 *
+	 * Writes leaving all watched bits unchanged do not call callback. For
+	 * registers up to 64 bits, old and new values are compared with a single
+	 * word operation before any event is built.
+	 * @param mask Watched bits
+	 * @param cb Callback
+	 * @return Callback ID
+	 */
+	::hv::common::hvcbID_t registerChangeCallback(
+			const ::hv::common::BitVector &mask, const PostWriteCallback &cb);
+
+	/**
+	 * Register a callback called after writes modifying a field
+	 * @param fieldName Watched field name
+	 * @param cb Callback
+	 * @return Callback ID
+	 */
+	::hv::common::hvcbID_t registerFieldChangeCallback(
+			const std::string &fieldName, const PostWriteCallback &cb);
+
+	bool unregisterChangeCallback(const ::hv::common::hvcbID_t &id);
+
+	std::size_t howManyChangeCallbacks() const;
+
+	// Asynchronous callbacks
+	/**
+	 * Register a post-read callback run on attached worker pool
+	 *
+	 * Callback receives a copy of the event and must not access the register:
+	 * it runs concurrently with simulation, after the access returned.
+	 * Asynchronous callbacks of a register run in access order.
+	 * @param cb Callback
+	 * @return Callback ID
+	 */
+	::hv::common::hvcbID_t registerAsyncPostReadCallback(
+			const PostReadCallback &cb);
+
+	/**
+	 * Register a post-write callback run on attached worker pool (see
+	 * registerAsyncPostReadCallback())
+	 * @param cb Callback
+	 * @return Callback ID
+	 */
+	::hv::common::hvcbID_t registerAsyncPostWriteCallback(
+			const PostWriteCallback &cb);
+
+	bool unregisterAsyncCallback(const ::hv::common::hvcbID_t &id);
+
+	std::size_t howManyAsyncCallbacks() const;
+
 	bool runPreReadCallbacks(const RegisterReadEvent& ev);
 	void runPostReadCallbacks(const RegisterReadEvent& ev);
 	bool runPreWriteCallbacks(const RegisterWriteEvent& ev);
 	void runPostWriteCallbacks(const RegisterWriteEvent& ev);
 
+	/**
+	 * Run post-write, CCI post-write and change callbacks of a write
+	 * @param oldVal Value before write
+	 * @param newVal Value after write
+	 */
+	void runPostWriteNotifications(const ::hv::common::BitVector &oldVal,
+			const ::hv::common::BitVector &newVal);
+
+	/**
+	 * Run or submit asynchronous post-read callbacks
+	 * @param ev Read event
+	 */
+	void runAsyncPostReadCallbacks(const RegisterReadEvent& ev);
+
+	/**
+	 * Run or submit asynchronous post-write callbacks
+	 * @param ev Write event
+	 */
+	void runAsyncPostWriteCallbacks(const RegisterWriteEvent& ev);
+
+	/**
+	 * Run change callbacks whose watched bits differ between two values
+	 * @param oldVal Value before write
+	 * @param newVal Value after write
+	 */
+	void runChangeCallbacks(const ::hv::common::BitVector &oldVal,
+			const ::hv::common::BitVector &newVal);
+
 private:
 	PreReadCallbackVector::iterator getPreReadCallbackIt(
 			const ::hv::common::hvcbID_t &id);
@@ -744,6 +1099,18 @@ protected:
 	 */
 	::hv::common::hvcbID_t getUniqueID();
 
+	/**
+	 * Notify listener of an access policy change
+	 */
+	void notifyAccessPolicyChange();
+
+	/**
+	 * Check if read() and write() have callbacks, access counters or trace
+	 * recorder
+	 * @return true if an access has side effects besides value update
+	 */
+	bool hasAccessHooks() const;
+
 //** Member values **//
 	/**
 	 * Register name
@@ -810,11 +1177,93 @@ protected:
 	 */
 	PostWriteCallbackVector postWriteCbVect;
 
+	/**
+	 * Change callback
+	 */
+	struct ChangeCallback {
+		::hv::common::BitVector mask;
+
+		/**
+		 * Watched bits as a word (registers up to 64 bits)
+		 */
+		::hv::common::hvuint64_t wordMask;
+
+		PostWriteCallback cb;
+	};
+
+	/**
+	 * Change callback vector
+	 */
+	std::vector<ChangeCallback> changeCbVect;
+
+	/**
+	 * Asynchronous post-read callback vector
+	 */
+	PostReadCallbackVector asyncPostReadCbVect;
+
+	/**
+	 * Asynchronous post-write callback vector
+	 */
+	PostWriteCallbackVector asyncPostWriteCbVect;
+
+	/**
+	 * Union of watched bits of change callbacks (all ones for registers
+	 * larger than 64 bits)
+	 */
+	::hv::common::hvuint64_t changeWordMask;
+
 	/**
 	 * Callback ID counter
 	 */
 	::hv::common::hvcbID_t cbIDCpt;
 
+	/**
+	 * Block holding access counters (nullptr when statistics are disabled)
+	 */
+	std::shared_ptr<std::vector<RegisterAccessCounters> > accessCounters;
+
+	/**
+	 * Index of access counters in block
+	 */
+	std::size_t accessCountersIndex;
+
+	/**
+	 * Trace recorder (nullptr when accesses are not traced)
+	 */
+	AccessTraceRecorder *traceRecorder;
+
+	/**
+	 * Address recorded in trace
+	 */
+	::hv::common::hvaddr_t traceAddress;
+
+	/**
+	 * Change listener (nullptr when no listener is attached)
+	 */
+	RegisterListener *listener;
+
+	/**
+	 * Post-write coalescer (nullptr when notifications are not coalesced)
+	 */
+	PostWriteCoalescer *coalescer;
+
+	/**
+	 * Worker pool of asynchronous callbacks (nullptr to run them synchronously)
+	 */
+	CallbackWorkerPool *workerPool;
+
+	/**
+	 * true if value is computed on demand by a derived class
+	 */
+	bool valueProvided;
+
+	/**
+	 * Bank selection hooks, by ID
+	 */
+	std::vector<
+			std::pair<::hv::common::hvcbID_t,
+					std::function<void(const Register&)> > > bankSelectHooks;
+
 private:
 	RegisterCCI regCCI;
 };
@@ -0,0 +1,63 @@
+/**
+ * @file register_access_counters.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register access statistics counters
+ *
+ * Counters are updated by Register::read() and Register::write() when attached
+ * to a register (see RegisterFile::enableAccessStatistics()).
+ * Defining HV_REG_DISABLE_STATISTICS removes counter updates at compile time.
+ */
+
+#ifndef HV_REGISTER_ACCESS_COUNTERS_H_
+#define HV_REGISTER_ACCESS_COUNTERS_H_
+
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+struct RegisterAccessCounters {
+
+	RegisterAccessCounters() :
+			reads(0u), writes(0u), readVetoes(0u), writeVetoes(0u), bytesRead(
+					0u), bytesWritten(0u) {
+	}
+
+	/**
+	 * Get total number of accesses (including vetoed ones)
+	 * @return Number of accesses
+	 */
+	::hv::common::hvuint64_t getAccesses() const {
+		return reads + writes + readVetoes + writeVetoes;
+	}
+
+	/**
+	 * Reset all counters
+	 */
+	void reset() {
+		*this = RegisterAccessCounters();
+	}
+
+	/**
+	 * Number of successful reads and writes
+	 */
+	::hv::common::hvuint64_t reads, writes;
+
+	/**
+	 * Number of reads and writes vetoed by a pre-callback
+	 */
+	::hv::common::hvuint64_t readVetoes, writeVetoes;
+
+	/**
+	 * Number of bytes transferred by successful reads and writes
+	 */
+	::hv::common::hvuint64_t bytesRead, bytesWritten;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTER_ACCESS_COUNTERS_H_ */
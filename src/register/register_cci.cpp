@@ -140,6 +140,7 @@ bool RegisterCCI::hasCallbacks() const {
 CallbackUntypedHandle RegisterCCI::registerPreWriteCallback(
 		const CallbackUntypedHandle& cb) {
 	preWriteCallbackVect.push_back(cb);
+	reg.notifyAccessPolicyChange();
 	return cb;
 }
 
@@ -148,6 +149,7 @@ bool RegisterCCI::unregisterPreWriteCallback(const CallbackUntypedHandle& cb) {
 			it != preWriteCallbackVect.end(); ++it) {
 		if (it->cb == cb.cb) {
 			preWriteCallbackVect.erase(it);
+			reg.notifyAccessPolicyChange();
 			return true;
 		}
 	}
@@ -156,6 +158,7 @@ bool RegisterCCI::unregisterPreWriteCallback(const CallbackUntypedHandle& cb) {
 CallbackUntypedHandle RegisterCCI::registerPostWriteCallback(
 		const CallbackUntypedHandle& cb) {
 	postWriteCallbackVect.push_back(cb);
+	reg.notifyAccessPolicyChange();
 	return cb;
 }
 
@@ -164,6 +167,7 @@ bool RegisterCCI::unregisterPostWriteCallback(const CallbackUntypedHandle& cb) {
 			it != postWriteCallbackVect.end(); ++it) {
 		if (it->cb == cb.cb) {
 			postWriteCallbackVect.erase(it);
+			reg.notifyAccessPolicyChange();
 			return true;
 		}
 	}
@@ -173,6 +177,7 @@ bool RegisterCCI::unregisterPostWriteCallback(const CallbackUntypedHandle& cb) {
 CallbackUntypedHandle RegisterCCI::registerPreReadCallback(
 		const CallbackUntypedHandle& cb) {
 	preReadCallbackVect.push_back(cb);
+	reg.notifyAccessPolicyChange();
 	return cb;
 }
 
@@ -181,6 +186,7 @@ bool RegisterCCI::unregisterPreReadCallback(const CallbackUntypedHandle& cb) {
 			++it) {
 		if (it->cb == cb.cb) {
 			preReadCallbackVect.erase(it);
+			reg.notifyAccessPolicyChange();
 			return true;
 		}
 	}
@@ -190,6 +196,7 @@ bool RegisterCCI::unregisterPreReadCallback(const CallbackUntypedHandle& cb) {
 CallbackUntypedHandle RegisterCCI::registerPostReadCallback(
 		const CallbackUntypedHandle& cb) {
 	postReadCallbackVect.push_back(cb);
+	reg.notifyAccessPolicyChange();
 	return cb;
 }
 
@@ -198,6 +205,7 @@ bool RegisterCCI::unregisterPostReadCallback(const CallbackUntypedHandle& cb) {
 			it != postReadCallbackVect.end(); ++it) {
 		if (it->cb == cb.cb) {
 			postReadCallbackVect.erase(it);
+			reg.notifyAccessPolicyChange();
 			return true;
 		}
 	}
@@ -209,6 +217,7 @@ bool RegisterCCI::unregisterAllCallbacks() {
 	postReadCallbackVect.clear();
 	preWriteCallbackVect.clear();
 	postWriteCallbackVect.clear();
+	reg.notifyAccessPolicyChange();
 	return true;
 }
 
@@ -0,0 +1,58 @@
+/**
+ * @file register_listener.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register change listener interface
+ *
+ * A listener attached to a register (see Register::setListener()) is notified
+ * when the register value changes, when an element altering the side effects
+ * of its accesses (callbacks, read mask, access counters, trace recorder) is
+ * added or removed, and when the register is destroyed. It is used to keep mirrors of register values up to date,
+ * e.g. DMI images of RegModule.
+ */
+
+#ifndef HV_REGISTER_LISTENER_H_
+#define HV_REGISTER_LISTENER_H_
+
+namespace hv {
+namespace reg {
+
+class Register;
+
+class RegisterListener {
+public:
+	virtual ~RegisterListener() {
+	}
+
+	/**
+	 * Called after register value changed
+	 *
+	 * Assignments to handles of Register::select() and Register::selectField()
+	 * are notified as well. Model code modifying register through
+	 * operator ()(), operator [] or its storage (getDataAddress()) must call
+	 * Register::notifyValueChange().
+	 * @param reg Modified register
+	 */
+	virtual void onValueChange(const Register &reg) = 0;
+
+	/**
+	 * Called after register access policy changed
+	 * @param reg Modified register
+	 */
+	virtual void onAccessPolicyChange(const Register &reg) = 0;
+
+	/**
+	 * Called when register is destroyed
+	 *
+	 * Listener must forget the register, which is not attached to it anymore.
+	 * @param reg Destroyed register
+	 */
+	virtual void onRegisterDestruction(const Register &reg) = 0;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTER_LISTENER_H_ */
@@ -0,0 +1,134 @@
+/**
+ * @file register_selection.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Handle on a bit range of a register value
+ */
+
+#include "register_selection.h"
+#include "register.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+RegisterSelection::RegisterSelection(Register &regIn, const std::size_t &ind1,
+		const std::size_t &ind2) :
+		reg(regIn), low(HV_MIN(ind1, ind2)), high(HV_MAX(ind1, ind2)) {
+	if (high >= reg.getSize()) {
+		HV_ERR(
+				"Selection [" << high << ":" << low << "] is out of register " << reg.getName())
+		exit(EXIT_FAILURE);
+	}
+}
+
+std::size_t RegisterSelection::getSize() const {
+	return high - low + 1u;
+}
+
+BitVector RegisterSelection::getValue() const {
+	const Register &regTmp(reg);
+	return regTmp(low, high);
+}
+
+RegisterSelection::operator BitVector() const {
+	return this->getValue();
+}
+
+RegisterSelection RegisterSelection::operator ()(const std::size_t &ind1,
+		const std::size_t &ind2) const {
+	if (HV_MAX(ind1, ind2) >= this->getSize()) {
+		HV_ERR("Sub-selection is out of selection of register " << reg.getName())
+		exit(EXIT_FAILURE);
+	}
+	return RegisterSelection(reg, low + ind1, low + ind2);
+}
+
+RegisterSelection RegisterSelection::operator [](const std::size_t &ind) const {
+	return (*this)(ind, ind);
+}
+
+RegisterSelection& RegisterSelection::operator =(const RegisterSelection &src) {
+	return *this = src.getValue();
+}
+
+RegisterSelection& RegisterSelection::operator =(const BitVector &value) {
+	const std::size_t size(reg.getSize());
+	const hvuint32_t shift(static_cast<hvuint32_t>(low));
+	// Written through whole register value, so that listener sees the change
+	const BitVector mask(
+			BitVector(size, ~BitVector(this->getSize(), 0u)) << shift);
+	reg.data = (reg.data & ~mask) | ((BitVector(size, value) << shift) & mask);
+	reg.notifyValueChange();
+	return *this;
+}
+
+RegisterSelection& RegisterSelection::operator &=(const BitVector &op2) {
+	return *this = (*this & op2);
+}
+
+RegisterSelection& RegisterSelection::operator |=(const BitVector &op2) {
+	return *this = (*this | op2);
+}
+
+RegisterSelection& RegisterSelection::operator ^=(const BitVector &op2) {
+	return *this = (*this ^ op2);
+}
+
+RegisterSelection& RegisterSelection::operator <<=(const hvuint32_t &shift) {
+	return *this = (*this << shift);
+}
+
+RegisterSelection& RegisterSelection::operator >>=(const hvuint32_t &shift) {
+	return *this = (*this >> shift);
+}
+
+BitVector RegisterSelection::operator ~() const {
+	return ~this->getValue();
+}
+
+BitVector RegisterSelection::operator &(const BitVector &op2) const {
+	return this->getValue() & BitVector(this->getSize(), op2);
+}
+
+BitVector RegisterSelection::operator |(const BitVector &op2) const {
+	return this->getValue() | BitVector(this->getSize(), op2);
+}
+
+BitVector RegisterSelection::operator ^(const BitVector &op2) const {
+	return this->getValue() ^ BitVector(this->getSize(), op2);
+}
+
+BitVector RegisterSelection::operator <<(const hvuint32_t &shift) const {
+	return this->getValue() << shift;
+}
+
+BitVector RegisterSelection::operator >>(const hvuint32_t &shift) const {
+	return this->getValue() >> shift;
+}
+
+BitVector RegisterSelection::operator +(const BitVector &op2) const {
+	return this->getValue() + op2;
+}
+
+bool RegisterSelection::operator ==(const BitVector &op2) const {
+	return this->getValue() == BitVector(this->getSize(), op2);
+}
+
+bool RegisterSelection::operator !=(const BitVector &op2) const {
+	return !(*this == op2);
+}
+
+bool RegisterSelection::operator !() const {
+	return !this->getValue();
+}
+
+std::ostream& operator <<(std::ostream &strm, const RegisterSelection &sel) {
+	return strm << sel.getValue();
+}
+
+} // namespace reg
+} // namespace hv
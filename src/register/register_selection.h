@@ -0,0 +1,167 @@
+/**
+ * @file register_selection.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Handle on a bit range of a register value
+ */
+
+#ifndef HV_REGISTER_SELECTION_H_
+#define HV_REGISTER_SELECTION_H_
+
+#include <iostream>
+#include <type_traits>
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+class Register;
+
+/**
+ * RegisterSelection class
+ *
+ * Returned by Register::select() and Register::selectField(), e.g.
+ * reg.selectField("Status") = 1; reg.select(8, 5) = reg2(4, 1); reg.select(12) = 1;
+ * Assigning a selection writes selected bits of register value and notifies
+ * register listener, as any other register modifier. Other operators work on
+ * a BitVector copy of selected bits.
+ */
+class RegisterSelection {
+public:
+//** Constructors **//
+	/**
+	 * RegisterSelection constructor
+	 * @param regIn Selected register
+	 * @param ind1 First index (LSB, resp. MSB of selection)
+	 * @param ind2 Second index (MSB, resp. LSB of selection)
+	 */
+	RegisterSelection(Register &regIn, const std::size_t &ind1,
+			const std::size_t &ind2);
+
+	RegisterSelection(const RegisterSelection &src) = default;
+
+//** Accessors **//
+	/**
+	 * Get selection size in bits
+	 * @return Selection size
+	 */
+	std::size_t getSize() const;
+
+	/**
+	 * Get value of selected bits
+	 * @return Selected bits, right-aligned
+	 */
+	::hv::common::BitVector getValue() const;
+
+	operator ::hv::common::BitVector() const;
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value,
+			int>::type = 0> operator T() const {
+		return static_cast<T>(this->getValue());
+	}
+
+//** Sub-selection **//
+	/**
+	 * Vector selection inside current selection
+	 * @param ind1 First index (LSB, resp. MSB of selection)
+	 * @param ind2 Second index (MSB, resp. LSB of selection)
+	 * @return Handle to selected bits
+	 */
+	RegisterSelection operator ()(const std::size_t &ind1,
+			const std::size_t &ind2) const;
+
+	/**
+	 * Bit selection inside current selection
+	 * @param ind Index of the bit to be selected
+	 * @return Handle to selected bit
+	 */
+	RegisterSelection operator [](const std::size_t &ind) const;
+
+//** Assignment **//
+	/**
+	 * Copy value of another selection (not the handle)
+	 * @param src Source selection
+	 * @return Current selection
+	 */
+	RegisterSelection& operator =(const RegisterSelection &src);
+
+	/**
+	 * Write selected bits
+	 * @param value Value, truncated to selection size
+	 * @return Current selection
+	 */
+	RegisterSelection& operator =(const ::hv::common::BitVector &value);
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value,
+			int>::type = 0> RegisterSelection& operator =(const T &value) {
+		return *this = ::hv::common::BitVector(this->getSize(), value);
+	}
+
+	RegisterSelection& operator &=(const ::hv::common::BitVector &op2);
+	RegisterSelection& operator |=(const ::hv::common::BitVector &op2);
+	RegisterSelection& operator ^=(const ::hv::common::BitVector &op2);
+	RegisterSelection& operator <<=(const ::hv::common::hvuint32_t &shift);
+	RegisterSelection& operator >>=(const ::hv::common::hvuint32_t &shift);
+
+//** Operators on selected value **//
+	::hv::common::BitVector operator ~() const;
+	::hv::common::BitVector operator &(const ::hv::common::BitVector &op2) const;
+	::hv::common::BitVector operator |(const ::hv::common::BitVector &op2) const;
+	::hv::common::BitVector operator ^(const ::hv::common::BitVector &op2) const;
+	::hv::common::BitVector operator <<(const ::hv::common::hvuint32_t &shift) const;
+	::hv::common::BitVector operator >>(const ::hv::common::hvuint32_t &shift) const;
+
+	/**
+	 * Concatenation
+	 * @param op2 LSB part
+	 * @return Selected bits followed by op2
+	 */
+	::hv::common::BitVector operator +(const ::hv::common::BitVector &op2) const;
+
+	bool operator ==(const ::hv::common::BitVector &op2) const;
+	bool operator !=(const ::hv::common::BitVector &op2) const;
+	bool operator !() const;
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value,
+			int>::type = 0> ::hv::common::BitVector operator &(const T &op2) const {
+		return *this & ::hv::common::BitVector(this->getSize(), op2);
+	}
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value,
+			int>::type = 0> ::hv::common::BitVector operator |(const T &op2) const {
+		return *this | ::hv::common::BitVector(this->getSize(), op2);
+	}
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value,
+			int>::type = 0> ::hv::common::BitVector operator ^(const T &op2) const {
+		return *this ^ ::hv::common::BitVector(this->getSize(), op2);
+	}
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value,
+			int>::type = 0> bool operator ==(const T &op2) const {
+		return *this == ::hv::common::BitVector(this->getSize(), op2);
+	}
+
+	template<typename T, typename std::enable_if<std::is_integral<T>::value,
+			int>::type = 0> bool operator !=(const T &op2) const {
+		return !(*this == op2);
+	}
+
+	friend std::ostream& operator <<(std::ostream &strm,
+			const RegisterSelection &sel);
+
+protected:
+	Register &reg;
+
+	/**
+	 * Selected indexes in register (low <= high)
+	 */
+	std::size_t low, high;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTER_SELECTION_H_ */
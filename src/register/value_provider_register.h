@@ -0,0 +1,178 @@
+/**
+ * @file value_provider_register.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register whose value is computed on demand
+ *
+ * Counters, timers and live status registers often derive their value from
+ * model state (e.g. sc_time_stamp()). Instead of updating them from a periodic
+ * process or a pre-read callback, a value provider computes their value when
+ * it is read by the bus (read(), readWord()), a debugger (debugRead(),
+ * getValue()) or a snapshot (RegisterFileObserver, RegisterFileSharedMemory).
+ */
+
+#ifndef HV_VALUE_PROVIDER_REGISTER_H_
+#define HV_VALUE_PROVIDER_REGISTER_H_
+
+#include <cstring>
+#include <functional>
+#include <hv/common.h>
+
+#include "register.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * ValueProviderRegister class
+ *
+ * T is the integral type returned by the provider, truncated to register size.
+ * Writes go through write callbacks as usual but do not modify the provided
+ * value. Casts, comparisons, selections and fields of Register call the
+ * provider as getValue() does.
+ */
+template<typename T> class ValueProviderRegister: public Register {
+public:
+//** Type definitions **//
+	typedef std::function<T()> provider_type;
+
+//** Constructors **//
+	/**
+	 * ValueProviderRegister constructor
+	 * @param sizeIn Register size in bit
+	 * @param nameIn Register name
+	 * @param providerIn Value provider, called on each read
+	 * @param descriptionIn Register description
+	 * @param modeIn Read/Write mode
+	 */
+	ValueProviderRegister(const std::size_t sizeIn, const std::string &nameIn,
+			const provider_type &providerIn,
+			const std::string &descriptionIn = std::string(""),
+			const ::hv::common::hvrwmode_t &modeIn = ::hv::common::hvrwmode_t::RO) :
+			Register(sizeIn, nameIn, descriptionIn, modeIn) {
+		this->setValueProvider(providerIn);
+		valueProvided = true;
+	}
+
+	/**
+	 * Copy constructor
+	 * @param src Source register for copy
+	 */
+	ValueProviderRegister(const ValueProviderRegister &src) :
+			Register(src), provider(src.provider) {
+		valueProvided = true;
+	}
+
+//** Destructor **//
+	virtual ~ValueProviderRegister() {
+	}
+
+//** Value provider **//
+	/**
+	 * Set value provider
+	 * @param providerIn Value provider, called on each read
+	 */
+	void setValueProvider(const provider_type &providerIn) {
+		if (!providerIn) {
+			HV_ERR("Value provider of register " << this->getName() << " is empty")
+			exit(EXIT_FAILURE);
+		}
+		provider = providerIn;
+	}
+
+	/**
+	 * Get value provider
+	 * @return Value provider
+	 */
+	const provider_type& getValueProvider() const {
+		return provider;
+	}
+
+//** Accessors **//
+	/**
+	 * Get current register value (calls provider)
+	 * @param applyReadMask Applies read mask to value if true
+	 * @return Register unmasked (default) or masked value
+	 */
+	::hv::common::BitVector getValue(const bool &applyReadMask = false) const
+			override {
+		::hv::common::BitVector ret(this->provide());
+		if (applyReadMask)
+			ret &= readMask;
+		return ret;
+	}
+
+//** Debug access **//
+	/**
+	 * Read current register value without side effects (calls provider)
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes (truncated to register size in bytes)
+	 */
+	void debugRead(::hv::common::hvuint8_t* readBuff,
+			const std::size_t &readSize) const override {
+		const std::size_t size(HV_MIN(readSize, this->getSizeInBytes()));
+		if (this->getSize() <= 64u) {
+			const ::hv::common::hvuint64_t value(this->provideWord());
+			std::memcpy(readBuff, &value, size);
+		} else {
+			::hv::common::BitVector value(this->provide());
+			std::memcpy(readBuff, value.getDataAddress(), size);
+		}
+	}
+
+//** Read/Write **//
+	/**
+	 * Read current register value (calls provider)
+	 *
+	 * Registers up to 64 bits without access hooks are read as one masked
+	 * word, with no BitVector allocation.
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes
+	 * @return true if success
+	 */
+	bool read(::hv::common::hvuint8_t* readBuff, const std::size_t &readSize)
+			override {
+		if ((readSize == this->getSizeInBytes()) && (this->getSize() <= 64u)
+				&& !this->hasAccessHooks()) {
+			::hv::common::hvuint64_t value(this->provideWord()), mask(0u);
+			std::memcpy(&mask, readMask.getDataAddress(), readSize);
+			value &= mask;
+			std::memcpy(readBuff, &value, readSize);
+			return true;
+		}
+		return Register::read(readBuff, readSize);
+	}
+
+	using Register::read;
+
+protected:
+	/**
+	 * Call provider
+	 * @return Provided value truncated to register size
+	 */
+	::hv::common::hvuint64_t provideWord() const {
+		const ::hv::common::hvuint64_t value(
+				static_cast<::hv::common::hvuint64_t>(provider()));
+		return (this->getSize() < 64u) ?
+				(value & ((::hv::common::hvuint64_t(1u) << this->getSize()) - 1u)) :
+				value;
+	}
+
+	/**
+	 * Call provider
+	 * @return Provided value as a register-sized BitVector
+	 */
+	::hv::common::BitVector provide() const {
+		return ::hv::common::BitVector(this->getSize(),
+				static_cast<::hv::common::hvuint64_t>(provider()));
+	}
+
+	provider_type provider;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_VALUE_PROVIDER_REGISTER_H_ */
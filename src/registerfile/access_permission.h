@@ -0,0 +1,150 @@
+/**
+ * @file access_permission.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Initiator-aware access permissions
+ */
+
+#ifndef HV_ACCESS_PERMISSION_H_
+#define HV_ACCESS_PERMISSION_H_
+
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+/**
+ * Attributes of a transaction checked against access permissions
+ */
+struct AccessAttributes {
+	AccessAttributes() :
+			initiatorId(0u), privileged(false), secure(false) {
+	}
+
+	AccessAttributes(const ::hv::common::hvuint32_t &initiatorIdIn,
+			const bool &privilegedIn, const bool &secureIn) :
+			initiatorId(initiatorIdIn), privileged(privilegedIn), secure(
+					secureIn) {
+	}
+
+	::hv::common::hvuint32_t initiatorId;
+	bool privileged;
+	bool secure;
+};
+
+/**
+ * Access permission of an address range
+ *
+ * Reads and writes have their own required attributes and their own set of
+ * allowed initiators (bit N set if initiator N is allowed). Initiators with an
+ * ID of 64 or more are only allowed when all initiators are.
+ */
+struct AccessPermission {
+	/**
+	 * Attributes a transaction must have (bitmask)
+	 */
+	enum Requirement {
+		NONE = 0, PRIVILEGED = 1, SECURE = 2
+	};
+
+	static const ::hv::common::hvuint64_t ALL_INITIATORS = ~::hv::common::hvuint64_t(
+			0u);
+
+	AccessPermission() :
+			readRequirements(NONE), writeRequirements(NONE), readInitiators(
+					ALL_INITIATORS), writeInitiators(ALL_INITIATORS) {
+	}
+
+	AccessPermission(const ::hv::common::hvuint8_t &readRequirementsIn,
+			const ::hv::common::hvuint8_t &writeRequirementsIn,
+			const ::hv::common::hvuint64_t &readInitiatorsIn =
+					~::hv::common::hvuint64_t(0u),
+			const ::hv::common::hvuint64_t &writeInitiatorsIn =
+					~::hv::common::hvuint64_t(0u)) :
+			readRequirements(readRequirementsIn), writeRequirements(
+					writeRequirementsIn), readInitiators(readInitiatorsIn), writeInitiators(
+					writeInitiatorsIn) {
+	}
+
+	/**
+	 * Permission of accesses from privileged transactions only
+	 */
+	static AccessPermission privilegedOnly() {
+		return AccessPermission(PRIVILEGED, PRIVILEGED);
+	}
+
+	/**
+	 * Permission of accesses from secure transactions only
+	 */
+	static AccessPermission secureOnly() {
+		return AccessPermission(SECURE, SECURE);
+	}
+
+	/**
+	 * Permission of reads from all initiators and writes from some of them only
+	 * @param writeInitiatorsIn Initiators allowed to write
+	 */
+	static AccessPermission readOnlyFor(
+			const ::hv::common::hvuint64_t &writeInitiatorsIn) {
+		return AccessPermission(NONE, NONE, ~::hv::common::hvuint64_t(0u),
+				writeInitiatorsIn);
+	}
+
+	/**
+	 * Restrict permission with another one (both must allow an access)
+	 * @param other Other permission
+	 * @return Reference to current permission
+	 */
+	AccessPermission& intersect(const AccessPermission &other) {
+		readRequirements |= other.readRequirements;
+		writeRequirements |= other.writeRequirements;
+		readInitiators &= other.readInitiators;
+		writeInitiators &= other.writeInitiators;
+		return *this;
+	}
+
+	/**
+	 * Check if permission allows all accesses
+	 * @return true if no check is needed, false else
+	 */
+	bool isUnrestricted() const {
+		return (readRequirements == NONE) && (writeRequirements == NONE)
+				&& (readInitiators == ALL_INITIATORS)
+				&& (writeInitiators == ALL_INITIATORS);
+	}
+
+	/**
+	 * Check if an access is allowed
+	 * @param attributes Transaction attributes
+	 * @param isRead true for a read, false for a write
+	 * @return true if access is allowed, false else
+	 */
+	bool allows(const AccessAttributes &attributes, const bool &isRead) const {
+		const ::hv::common::hvuint8_t requirements(
+				isRead ? readRequirements : writeRequirements);
+		const ::hv::common::hvuint64_t initiators(
+				isRead ? readInitiators : writeInitiators);
+		const ::hv::common::hvuint8_t provided(
+				(attributes.privileged ? PRIVILEGED : NONE)
+						| (attributes.secure ? SECURE : NONE));
+		if ((provided & requirements) != requirements) {
+			return false;
+		}
+		if (attributes.initiatorId >= 64u) {
+			return initiators == ALL_INITIATORS;
+		}
+		return (initiators >> attributes.initiatorId) & 1u;
+	}
+
+	::hv::common::hvuint8_t readRequirements;
+	::hv::common::hvuint8_t writeRequirements;
+	::hv::common::hvuint64_t readInitiators;
+	::hv::common::hvuint64_t writeInitiators;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_ACCESS_PERMISSION_H_ */
@@ -0,0 +1,196 @@
+/**
+ * @file address_region.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Address region interface class
+ */
+
+#ifndef HV_ADDRESS_REGION_H_
+#define HV_ADDRESS_REGION_H_
+
+#include <string>
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+class AddressRegion;
+
+/**
+ * Address region listener interface
+ *
+ * A listener attached to a region (see AddressRegion::setListener()) is
+ * notified when direct memory pointers previously given by the region become
+ * invalid, and when the region is destroyed. It is used by RegModule to invalidate granted DMI pointers.
+ */
+class AddressRegionListener {
+public:
+	virtual ~AddressRegionListener() {
+	}
+
+	/**
+	 * Called after direct memory pointers of an offset range became invalid
+	 * @param region Modified region
+	 * @param startOffset Range start offset
+	 * @param endOffset Range end offset (included)
+	 */
+	virtual void onDirectMemoryInvalidation(const AddressRegion &region,
+			const ::hv::common::hvaddr_t &startOffset,
+			const ::hv::common::hvaddr_t &endOffset) = 0;
+
+	/**
+	 * Called when region is destroyed
+	 *
+	 * Listener must forget the region, which is not attached to it anymore.
+	 * @param region Destroyed region
+	 */
+	virtual void onRegionDestruction(const AddressRegion &region) = 0;
+};
+
+/**
+ * AddressRegion class
+ *
+ * Address range of a register file whose accesses are not served by Register
+ * objects (register arrays, memories). Regions are inserted by reference with
+ * RegisterFile::addRegion() and accessed by offset from their start address.
+ */
+class AddressRegion {
+public:
+//** Destructor **//
+	virtual ~AddressRegion() {
+		if (listener != nullptr) {
+			listener->onRegionDestruction(*this);
+		}
+	}
+
+//** Accessors **//
+	/**
+	 * Get name
+	 * @return Region name
+	 */
+	virtual std::string getName() const = 0;
+
+	/**
+	 * Get description
+	 * @return Region description
+	 */
+	virtual std::string getDescription() const = 0;
+
+	/**
+	 * Get size of covered address range
+	 * @return Region size in bytes
+	 */
+	virtual std::size_t getSizeInBytes() const = 0;
+
+//** Read/Write **//
+	/**
+	 * Read data from region
+	 *
+	 * Access must not go beyond region end.
+	 * @param offset Offset from region start
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes
+	 * @return true if success
+	 */
+	virtual bool read(const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvuint8_t* readBuff, const std::size_t &readSize) = 0;
+
+	/**
+	 * Write data to region
+	 *
+	 * Access must not go beyond region end.
+	 * @param offset Offset from region start
+	 * @param writeBuff Write buffer
+	 * @param writeSize Write size in bytes
+	 * @return true if success
+	 */
+	virtual bool write(const ::hv::common::hvaddr_t &offset,
+			const ::hv::common::hvuint8_t* writeBuff,
+			const std::size_t &writeSize) = 0;
+
+//** Debug access **//
+	/**
+	 * Read region data without side effects
+	 * @param offset Offset from region start
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes
+	 */
+	virtual void debugRead(const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvuint8_t* readBuff,
+			const std::size_t &readSize) const = 0;
+
+	/**
+	 * Write region data without side effects
+	 * @param offset Offset from region start
+	 * @param writeBuff Write buffer
+	 * @param writeSize Write size in bytes
+	 */
+	virtual void debugWrite(const ::hv::common::hvaddr_t &offset,
+			const ::hv::common::hvuint8_t* writeBuff,
+			const std::size_t &writeSize) = 0;
+
+//** Direct memory access **//
+	/**
+	 * Get direct memory pointer on region storage
+	 *
+	 * Regions whose accesses have no side effect may give a pointer on the
+	 * storage of an offset range including offset. Reads and writes through
+	 * this pointer bypass read() and write(). Default implementation gives
+	 * no pointer.
+	 * @param offset Offset from region start
+	 * @param startOffset Set to start offset of range covered by pointer
+	 * @param endOffset Set to end offset (included) of range covered by pointer
+	 * @return Pointer on storage of startOffset, nullptr if not available
+	 */
+	virtual ::hv::common::hvuint8_t* getDirectMemPtr(
+			const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvaddr_t &startOffset,
+			::hv::common::hvaddr_t &endOffset) {
+		return nullptr;
+	}
+
+	/**
+	 * Attach listener notified of direct memory pointer invalidations
+	 * @param listenerIn Listener, nullptr to detach
+	 */
+	void setListener(AddressRegionListener *listenerIn) {
+		listener = listenerIn;
+	}
+
+	/**
+	 * Get attached listener
+	 * @return Listener, nullptr if none
+	 */
+	AddressRegionListener* getListener() const {
+		return listener;
+	}
+
+protected:
+//** Constructors **//
+	AddressRegion() :
+			listener(nullptr) {
+	}
+
+	/**
+	 * Notify listener that direct memory pointers of an offset range became
+	 * invalid
+	 * @param startOffset Range start offset
+	 * @param endOffset Range end offset (included)
+	 */
+	void notifyDirectMemoryInvalidation(
+			const ::hv::common::hvaddr_t &startOffset,
+			const ::hv::common::hvaddr_t &endOffset) const {
+		if (listener != nullptr) {
+			listener->onDirectMemoryInvalidation(*this, startOffset, endOffset);
+		}
+	}
+
+	AddressRegionListener *listener;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_ADDRESS_REGION_H_ */
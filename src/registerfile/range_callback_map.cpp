@@ -0,0 +1,134 @@
+/**
+ * @file range_callback_map.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Address-range callbacks
+ */
+
+#include <algorithm>
+
+#include "range_callback_map.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+RangeCallbackMap::RangeCallbackMap() :
+		nextId(0u) {
+}
+
+RangeCallbackMap::~RangeCallbackMap() {
+}
+
+hvcbID_t RangeCallbackMap::add(const hvaddr_t &start, const hvaddr_t &end,
+		const RangeCallbackPhase &phase, const RangeCallback &cb) {
+	const hvcbID_t id(nextId++);
+	entries[id] = Entry { start, end, phase, cb };
+	split(start);
+	if (end != ~hvaddr_t(0u)) {
+		split(end + 1u);
+	}
+	for (std::map<hvaddr_t, std::vector<hvcbID_t> >::iterator it =
+			segments.find(start); (it != segments.end()) && (it->first <= end);
+			++it) {
+		it->second.push_back(id);
+	}
+	return id;
+}
+
+bool RangeCallbackMap::remove(const hvcbID_t &id) {
+	std::map<hvcbID_t, Entry>::iterator entry = entries.find(id);
+	if (entry == entries.end()) {
+		return false;
+	}
+	for (std::map<hvaddr_t, std::vector<hvcbID_t> >::iterator it =
+			segments.find(entry->second.start);
+			(it != segments.end()) && (it->first <= entry->second.end); ++it) {
+		it->second.erase(std::find(it->second.begin(), it->second.end(), id));
+	}
+	entries.erase(entry);
+	if (entries.empty()) {
+		segments.clear();
+	}
+	return true;
+}
+
+bool RangeCallbackMap::isEmpty() const {
+	return entries.empty();
+}
+
+bool RangeCallbackMap::covers(const hvaddr_t &address,
+		const std::size_t &size) const {
+	const hvaddr_t last(lastAddress(address, size));
+	for (std::map<hvaddr_t, std::vector<hvcbID_t> >::const_iterator it =
+			firstSegment(address);
+			(it != segments.cend()) && (it->first <= last); ++it) {
+		if (!it->second.empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool RangeCallbackMap::dispatch(const RangeCallbackPhase &phase,
+		const hvaddr_t &address, Register &reg, const hvuint8_t *data,
+		const std::size_t &size) const {
+	const hvaddr_t last(lastAddress(address, size));
+	// Copy of IDs: callbacks may register or unregister callbacks
+	std::vector<hvcbID_t> ids;
+	for (std::map<hvaddr_t, std::vector<hvcbID_t> >::const_iterator it =
+			firstSegment(address);
+			(it != segments.cend()) && (it->first <= last); ++it) {
+		ids.insert(ids.end(), it->second.cbegin(), it->second.cend());
+	}
+	// A range overlapping several segments of access is called once
+	std::sort(ids.begin(), ids.end());
+	ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+	bool ret(true);
+	for (std::size_t i = 0; i < ids.size(); i++) {
+		std::map<hvcbID_t, Entry>::const_iterator entry = entries.find(ids[i]);
+		if ((entry == entries.cend()) || (entry->second.phase != phase)) {
+			continue;
+		}
+		const hvaddr_t first(HV_MAX(address, entry->second.start));
+		RangeAccessEvent event = { phase, address, first
+				- entry->second.start, first - address, reg, data, size };
+		ret = entry->second.cb(event) && ret;
+	}
+	return ret;
+}
+
+std::map<hvaddr_t, std::vector<hvcbID_t> >::const_iterator RangeCallbackMap::firstSegment(
+		const hvaddr_t &address) const {
+	std::map<hvaddr_t, std::vector<hvcbID_t> >::const_iterator it =
+			segments.upper_bound(address);
+	if (it != segments.cbegin()) {
+		--it;
+	}
+	return it;
+}
+
+hvaddr_t RangeCallbackMap::lastAddress(const hvaddr_t &address,
+		const std::size_t &size) {
+	return size ? address + (size - 1u) : address;
+}
+
+void RangeCallbackMap::split(const hvaddr_t &address) {
+	std::map<hvaddr_t, std::vector<hvcbID_t> >::iterator it =
+			segments.upper_bound(address);
+	if (it == segments.begin()) {
+		segments[address];
+		return;
+	}
+	--it;
+	if (it->first != address) {
+		// New segment inherits callbacks of the segment it is cut from
+		segments[address] = it->second;
+	}
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,195 @@
+/**
+ * @file range_callback_map.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Address-range callbacks
+ */
+
+#ifndef HV_RANGE_CALLBACK_MAP_H_
+#define HV_RANGE_CALLBACK_MAP_H_
+
+#include <functional>
+#include <map>
+#include <vector>
+#include <hv/common.h>
+
+#include "../register/register.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * Access phase of an address-range callback
+ */
+enum RangeCallbackPhase {
+	RANGE_PRE_READ = 0, RANGE_POST_READ = 1, RANGE_PRE_WRITE = 2, RANGE_POST_WRITE = 3
+};
+
+/**
+ * Access seen by an address-range callback
+ */
+struct RangeAccessEvent {
+	RangeCallbackPhase phase;
+
+	/**
+	 * Address of accessed register, relatively to register file
+	 */
+	::hv::common::hvaddr_t address;
+
+	/**
+	 * Offset of first accessed byte covered by callback range, from start of
+	 * callback range
+	 */
+	::hv::common::hvaddr_t offset;
+
+	/**
+	 * Offset of first accessed byte covered by callback range, from start of
+	 * accessed register (non-zero when range starts inside register)
+	 */
+	::hv::common::hvaddr_t registerOffset;
+
+	/**
+	 * Accessed register
+	 */
+	Register &reg;
+
+	/**
+	 * Access data from start of register (written data, or read data in
+	 * post-read phase)
+	 */
+	const ::hv::common::hvuint8_t *data;
+
+	/**
+	 * Access size in bytes
+	 */
+	std::size_t size;
+};
+
+/**
+ * Address-range callback
+ *
+ * In pre-read and pre-write phases, returning false vetoes the access. Return
+ * value is ignored in post phases.
+ */
+typedef std::function<bool(const RangeAccessEvent&)> RangeCallback;
+
+/**
+ * RangeCallbackMap class
+ *
+ * Interval map of address-range callbacks. Callback ranges split the address
+ * space into segments, each listing the callbacks covering it, so that
+ * callbacks of an address are found with a single ordered-map lookup
+ * whatever the number of ranges.
+ */
+class RangeCallbackMap {
+public:
+//** Constructors **//
+	RangeCallbackMap();
+
+//** Destructor **//
+	virtual ~RangeCallbackMap();
+
+//** Callback registration **//
+	/**
+	 * Register a callback on an address range
+	 * @param start Range start address
+	 * @param end Range end address (included)
+	 * @param phase Access phase
+	 * @param cb Callback
+	 * @return Callback ID
+	 */
+	::hv::common::hvcbID_t add(const ::hv::common::hvaddr_t &start,
+			const ::hv::common::hvaddr_t &end, const RangeCallbackPhase &phase,
+			const RangeCallback &cb);
+
+	/**
+	 * Unregister a callback
+	 * @param id Callback ID
+	 * @return true if callback was found, false else
+	 */
+	bool remove(const ::hv::common::hvcbID_t &id);
+
+	/**
+	 * Check if no callback is registered
+	 * @return true if empty, false else
+	 */
+	bool isEmpty() const;
+
+	/**
+	 * Check if callbacks cover part of an access
+	 * @param address Access address
+	 * @param size Access size in bytes
+	 * @return true if at least one callback range overlaps access
+	 */
+	bool covers(const ::hv::common::hvaddr_t &address,
+			const std::size_t &size = 1u) const;
+
+//** Dispatch **//
+	/**
+	 * Call callbacks of a phase overlapping an access, once each, in
+	 * registration order
+	 * @param phase Access phase
+	 * @param address Register address
+	 * @param reg Accessed register
+	 * @param data Access data
+	 * @param size Access size in bytes
+	 * @return false if a callback vetoed the access, true else
+	 */
+	bool dispatch(const RangeCallbackPhase &phase,
+			const ::hv::common::hvaddr_t &address, Register &reg,
+			const ::hv::common::hvuint8_t *data, const std::size_t &size) const;
+
+protected:
+	/**
+	 * Registered callback
+	 */
+	struct Entry {
+		::hv::common::hvaddr_t start;
+		::hv::common::hvaddr_t end;
+		RangeCallbackPhase phase;
+		RangeCallback cb;
+	};
+
+	/**
+	 * Split segments so that one starts at address
+	 * @param address Segment start address
+	 */
+	void split(const ::hv::common::hvaddr_t &address);
+
+	/**
+	 * Get first segment overlapping an address range
+	 * @param address Range start address
+	 * @return Segment including address, or first segment after it
+	 */
+	std::map<::hv::common::hvaddr_t, std::vector<::hv::common::hvcbID_t> >::const_iterator firstSegment(
+			const ::hv::common::hvaddr_t &address) const;
+
+	/**
+	 * Get last address of an access
+	 * @param address Access address
+	 * @param size Access size in bytes (0 is considered as 1)
+	 * @return Last accessed address
+	 */
+	static ::hv::common::hvaddr_t lastAddress(
+			const ::hv::common::hvaddr_t &address, const std::size_t &size);
+
+	/**
+	 * Callbacks by ID (IDs increase with registration order)
+	 */
+	std::map<::hv::common::hvcbID_t, Entry> entries;
+
+	/**
+	 * Callback IDs covering each segment, by segment start address. A segment
+	 * ends where next one starts.
+	 */
+	std::map<::hv::common::hvaddr_t, std::vector<::hv::common::hvcbID_t> > segments;
+
+	::hv::common::hvcbID_t nextId;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_RANGE_CALLBACK_MAP_H_ */
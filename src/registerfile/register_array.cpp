@@ -0,0 +1,325 @@
+/**
+ * @file register_array.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Array of registers sharing one layout
+ */
+
+#include <cstring>
+#include <sstream>
+
+#include "register_array.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+RegisterArray::RegisterArray(const std::size_t &nElementsIn,
+		const std::size_t &sizeIn, const std::string &nameIn,
+		const std::string &descriptionIn, const hvrwmode_t &modeIn,
+		const hvuint64_t &resetIn, const std::size_t &strideIn) :
+		layout(sizeIn, nameIn, descriptionIn, modeIn, BitVector(sizeIn, resetIn)), nElements(
+				nElementsIn), elementSizeInBytes((sizeIn + 7u) / 8u), stride(
+				strideIn ? strideIn : superiorPowerOf2((sizeIn + 7u) / 8u)), valueMask(
+				sizeIn >= 64u ? ~hvuint64_t(0u) : (hvuint64_t(1u) << sizeIn) - 1u), resetVal(
+				resetIn & valueMask), readMask(0u), writeMask(0u), nextId(0u) {
+	if ((sizeIn == 0u) || (sizeIn > 64u)) {
+		HV_ERR(
+				"Element size of register array " << nameIn << " must be between 1 and 64 bits")
+		exit(EXIT_FAILURE);
+	}
+	if (nElements == 0u) {
+		HV_ERR("Register array " << nameIn << " has no element")
+		exit(EXIT_FAILURE);
+	}
+	if (stride < elementSizeInBytes) {
+		HV_ERR(
+				"Stride of register array " << nameIn << " is lower than element size")
+		exit(EXIT_FAILURE);
+	}
+	values.resize(nElements * elementSizeInBytes);
+	this->updateMasks();
+	this->reset();
+}
+
+RegisterArray::~RegisterArray() {
+}
+
+std::string RegisterArray::getName() const {
+	return layout.getName();
+}
+
+std::string RegisterArray::getDescription() const {
+	return layout.getDescription();
+}
+
+std::size_t RegisterArray::getSizeInBytes() const {
+	return nElements * stride;
+}
+
+std::string RegisterArray::getElementName(const std::size_t &index) const {
+	std::ostringstream ret;
+	ret << layout.getName() << "_" << index;
+	return ret.str();
+}
+
+std::size_t RegisterArray::getElementCount() const {
+	return nElements;
+}
+
+std::size_t RegisterArray::getElementSize() const {
+	return layout.getSize();
+}
+
+std::size_t RegisterArray::getElementSizeInBytes() const {
+	return elementSizeInBytes;
+}
+
+std::size_t RegisterArray::getStride() const {
+	return stride;
+}
+
+hvrwmode_t RegisterArray::getRWMode() const {
+	return layout.getRWMode();
+}
+
+hvuint64_t RegisterArray::getReadMask() const {
+	return readMask;
+}
+
+hvuint64_t RegisterArray::getWriteMask() const {
+	return writeMask;
+}
+
+const Register& RegisterArray::getLayout() const {
+	return layout;
+}
+
+void RegisterArray::createField(const std::string &fieldName,
+		const std::size_t &ind1, const std::size_t &ind2,
+		const std::string &fieldDescription, const hvrwmode_t &fieldRWMode) {
+	layout.createField(fieldName, ind1, ind2, fieldDescription, fieldRWMode);
+	this->updateMasks();
+}
+
+void RegisterArray::createField(const std::string &fieldName,
+		const std::size_t &ind1, const std::size_t &ind2,
+		const hvrwmode_t &fieldRWMode) {
+	this->createField(fieldName, ind1, ind2, std::string(""), fieldRWMode);
+}
+
+hvuint64_t RegisterArray::getValue(const std::size_t &index) const {
+	this->checkIndex(index);
+	hvuint64_t ret(0u);
+	std::memcpy(&ret, values.data() + index * elementSizeInBytes,
+			elementSizeInBytes);
+	return ret;
+}
+
+void RegisterArray::setValue(const std::size_t &index, const hvuint64_t &value) {
+	this->checkIndex(index);
+	const hvuint64_t valueTmp(value & valueMask);
+	std::memcpy(values.data() + index * elementSizeInBytes, &valueTmp,
+			elementSizeInBytes);
+}
+
+hvuint64_t RegisterArray::getFieldValue(const std::size_t &index,
+		const std::string &fieldName) const {
+	std::size_t low;
+	const hvuint64_t mask(this->getFieldMask(fieldName, low));
+	return (this->getValue(index) >> low) & mask;
+}
+
+void RegisterArray::setFieldValue(const std::size_t &index,
+		const std::string &fieldName, const hvuint64_t &value) {
+	std::size_t low;
+	const hvuint64_t mask(this->getFieldMask(fieldName, low));
+	this->setValue(index,
+			(this->getValue(index) & ~(mask << low)) | ((value & mask) << low));
+}
+
+void RegisterArray::reset() {
+	for (std::size_t i = 0; i < nElements; i++) {
+		std::memcpy(values.data() + i * elementSizeInBytes, &resetVal,
+				elementSizeInBytes);
+	}
+}
+
+bool RegisterArray::readElement(const std::size_t &index, hvuint64_t &value) {
+	const hvuint64_t current(this->getValue(index));
+	if (!this->dispatch(ARRAY_PRE_READ, index, current, current)) {
+		return false;
+	}
+	value = current & readMask;
+	this->dispatch(ARRAY_POST_READ, index, current, current);
+	return true;
+}
+
+bool RegisterArray::writeElement(const std::size_t &index,
+		const hvuint64_t &value) {
+	const hvuint64_t oldValue(this->getValue(index));
+	const hvuint64_t newValue(
+			((oldValue & ~writeMask) | (value & writeMask)) & valueMask);
+	if (!this->dispatch(ARRAY_PRE_WRITE, index, oldValue, newValue)) {
+		return false;
+	}
+	this->setValue(index, newValue);
+	this->dispatch(ARRAY_POST_WRITE, index, oldValue, newValue);
+	return true;
+}
+
+hvcbID_t RegisterArray::registerCallback(const RegisterArrayPhase &phase,
+		const RegisterArrayCallback &cb, const std::size_t &first,
+		const std::size_t &last) {
+	const hvcbID_t id(nextId++);
+	callbacks.push_back(CallbackEntry { id, phase, first, last, cb });
+	return id;
+}
+
+bool RegisterArray::unregisterCallback(const hvcbID_t &id) {
+	for (std::vector<CallbackEntry>::iterator it = callbacks.begin();
+			it != callbacks.end(); ++it) {
+		if (it->id == id) {
+			callbacks.erase(it);
+			return true;
+		}
+	}
+	return false;
+}
+
+std::size_t RegisterArray::howManyCallbacks() const {
+	return callbacks.size();
+}
+
+bool RegisterArray::read(const hvaddr_t &offset, hvuint8_t* readBuff,
+		const std::size_t &readSize) {
+	std::size_t done(0u);
+	while (done < readSize) {
+		const std::size_t index((offset + done) / stride);
+		const std::size_t inner((offset + done) % stride);
+		const std::size_t chunk(HV_MIN(readSize - done, stride - inner));
+		std::size_t n(0u);
+		if (inner < elementSizeInBytes) {
+			hvuint64_t value;
+			if (!this->readElement(index, value)) {
+				return false;
+			}
+			n = HV_MIN(chunk, elementSizeInBytes - inner);
+			std::memcpy(readBuff + done,
+					reinterpret_cast<const hvuint8_t*>(&value) + inner, n);
+		}
+		// Padding between elements reads as zero
+		std::memset(readBuff + done + n, 0, chunk - n);
+		done += chunk;
+	}
+	return true;
+}
+
+bool RegisterArray::write(const hvaddr_t &offset, const hvuint8_t* writeBuff,
+		const std::size_t &writeSize) {
+	std::size_t done(0u);
+	while (done < writeSize) {
+		const std::size_t index((offset + done) / stride);
+		const std::size_t inner((offset + done) % stride);
+		const std::size_t chunk(HV_MIN(writeSize - done, stride - inner));
+		if (inner < elementSizeInBytes) {
+			// Bytes of element out of access are kept
+			hvuint64_t value(this->getValue(index));
+			std::memcpy(reinterpret_cast<hvuint8_t*>(&value) + inner,
+					writeBuff + done, HV_MIN(chunk, elementSizeInBytes - inner));
+			if (!this->writeElement(index, value)) {
+				return false;
+			}
+		}
+		done += chunk;
+	}
+	return true;
+}
+
+void RegisterArray::debugRead(const hvaddr_t &offset, hvuint8_t* readBuff,
+		const std::size_t &readSize) const {
+	std::size_t done(0u);
+	while (done < readSize) {
+		const std::size_t index((offset + done) / stride);
+		const std::size_t inner((offset + done) % stride);
+		const std::size_t chunk(HV_MIN(readSize - done, stride - inner));
+		std::size_t n(0u);
+		if (inner < elementSizeInBytes) {
+			this->checkIndex(index);
+			n = HV_MIN(chunk, elementSizeInBytes - inner);
+			std::memcpy(readBuff + done,
+					values.data() + index * elementSizeInBytes + inner, n);
+		}
+		std::memset(readBuff + done + n, 0, chunk - n);
+		done += chunk;
+	}
+}
+
+void RegisterArray::debugWrite(const hvaddr_t &offset,
+		const hvuint8_t* writeBuff, const std::size_t &writeSize) {
+	std::size_t done(0u);
+	while (done < writeSize) {
+		const std::size_t index((offset + done) / stride);
+		const std::size_t inner((offset + done) % stride);
+		const std::size_t chunk(HV_MIN(writeSize - done, stride - inner));
+		if (inner < elementSizeInBytes) {
+			hvuint64_t value(this->getValue(index));
+			std::memcpy(reinterpret_cast<hvuint8_t*>(&value) + inner,
+					writeBuff + done, HV_MIN(chunk, elementSizeInBytes - inner));
+			this->setValue(index, value);
+		}
+		done += chunk;
+	}
+}
+
+void RegisterArray::checkIndex(const std::size_t &index) const {
+	if (index >= nElements) {
+		HV_ERR(
+				"No element " << std::dec << index << " in register array " << layout.getName())
+		exit(EXIT_FAILURE);
+	}
+}
+
+hvuint64_t RegisterArray::getFieldMask(const std::string &fieldName,
+		std::size_t &low) const {
+	std::pair<std::size_t, std::size_t> indexes(
+			layout.getFieldIndexes(fieldName));
+	low = indexes.first;
+	const std::size_t width(indexes.second - indexes.first + 1u);
+	return (width >= 64u) ? ~hvuint64_t(0u) : (hvuint64_t(1u) << width) - 1u;
+}
+
+void RegisterArray::updateMasks() {
+	readMask = 0u;
+	writeMask = 0u;
+	BitVector readMaskTmp(layout.getReadMask());
+	BitVector writeMaskTmp(layout.getWriteMask());
+	std::memcpy(&readMask, readMaskTmp.getDataAddress(), elementSizeInBytes);
+	std::memcpy(&writeMask, writeMaskTmp.getDataAddress(), elementSizeInBytes);
+	readMask &= valueMask;
+	writeMask &= valueMask;
+}
+
+bool RegisterArray::dispatch(const RegisterArrayPhase &phase,
+		const std::size_t &index, const hvuint64_t &oldValue,
+		const hvuint64_t &newValue) {
+	// Callbacks may unregister callbacks: iterating by index
+	for (std::size_t i = 0; i < callbacks.size(); i++) {
+		if ((callbacks[i].phase != phase) || (index < callbacks[i].first)
+				|| (index > callbacks[i].last)) {
+			continue;
+		}
+		RegisterArrayCallback cb(callbacks[i].cb);
+		if (!cb(RegisterArrayEvent { phase, *this, index, oldValue, newValue })
+				&& ((phase == ARRAY_PRE_READ) || (phase == ARRAY_PRE_WRITE))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,368 @@
+/**
+ * @file register_array.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Array of registers sharing one layout
+ *
+ * Lookup tables and descriptor arrays with thousands of identical registers
+ * do not need one Register object per element: a register array keeps one
+ * layout (name, modes, fields, masks, reset value) for all elements and packs
+ * element values contiguously. Element N is decoded at offset N * stride of
+ * the array.
+ */
+
+#ifndef HV_REGISTER_ARRAY_H_
+#define HV_REGISTER_ARRAY_H_
+
+#include <functional>
+#include <vector>
+#include <hv/common.h>
+
+#include "../register/register.h"
+#include "address_region.h"
+
+namespace hv {
+namespace reg {
+
+class RegisterArray;
+
+/**
+ * Access phase of a register array callback
+ */
+enum RegisterArrayPhase {
+	ARRAY_PRE_READ = 0, ARRAY_POST_READ = 1, ARRAY_PRE_WRITE = 2, ARRAY_POST_WRITE = 3
+};
+
+/**
+ * Element access seen by a register array callback
+ */
+struct RegisterArrayEvent {
+	RegisterArrayPhase phase;
+
+	RegisterArray &array;
+
+	/**
+	 * Accessed element index
+	 */
+	std::size_t index;
+
+	/**
+	 * Element value before access
+	 */
+	::hv::common::hvuint64_t oldValue;
+
+	/**
+	 * Element value after access (value to be written in pre-write phase,
+	 * oldValue for reads)
+	 */
+	::hv::common::hvuint64_t newValue;
+};
+
+/**
+ * Register array callback
+ *
+ * In pre-read and pre-write phases, returning false vetoes the access. Return
+ * value is ignored in post phases.
+ */
+typedef std::function<bool(const RegisterArrayEvent&)> RegisterArrayCallback;
+
+/**
+ * RegisterArray class
+ *
+ * Elements are 64 bits or less. Bus accesses (read(), write(), readElement(),
+ * writeElement()) apply layout masks and call element callbacks; value
+ * accessors (getValue(), setValue()) and debug accesses do not.
+ */
+class RegisterArray: public AddressRegion {
+public:
+//** Constructors **//
+	/**
+	 * RegisterArray constructor
+	 * @param nElementsIn Number of elements
+	 * @param sizeIn Element size in bits (64 at most)
+	 * @param nameIn Array name (element N is named nameIn_N)
+	 * @param descriptionIn Array description
+	 * @param modeIn Element Read/Write mode
+	 * @param resetIn Element reset value
+	 * @param strideIn Bytes between element addresses, 0 for element size
+	 * rounded up to a power of 2
+	 */
+	RegisterArray(const std::size_t &nElementsIn, const std::size_t &sizeIn,
+			const std::string &nameIn,
+			const std::string &descriptionIn = std::string(""),
+			const ::hv::common::hvrwmode_t &modeIn =
+					::hv::common::hvrwmode_t::NA,
+			const ::hv::common::hvuint64_t &resetIn = 0u,
+			const std::size_t &strideIn = 0u);
+
+	RegisterArray(const RegisterArray &) = delete;
+	RegisterArray& operator=(const RegisterArray &) = delete;
+
+//** Destructor **//
+	virtual ~RegisterArray();
+
+//** Accessors **//
+	std::string getName() const override;
+
+	std::string getDescription() const override;
+
+	/**
+	 * Get size of covered address range
+	 * @return Number of elements times stride
+	 */
+	std::size_t getSizeInBytes() const override;
+
+	/**
+	 * Get element name
+	 * @param index Element index
+	 * @return Array name followed by "_" and index
+	 */
+	std::string getElementName(const std::size_t &index) const;
+
+	std::size_t getElementCount() const;
+
+	/**
+	 * Get element size in bits
+	 * @return Element size
+	 */
+	std::size_t getElementSize() const;
+
+	std::size_t getElementSizeInBytes() const;
+
+	std::size_t getStride() const;
+
+	::hv::common::hvrwmode_t getRWMode() const;
+
+	::hv::common::hvuint64_t getReadMask() const;
+
+	::hv::common::hvuint64_t getWriteMask() const;
+
+	/**
+	 * Get layout shared by all elements
+	 * @return Register describing elements (its value is not used)
+	 */
+	const Register& getLayout() const;
+
+//** Layout **//
+	/**
+	 * Create field in all elements
+	 * @param fieldName Field name
+	 * @param ind1 Starting index (MSB, resp. LSB)
+	 * @param ind2 Ending index (LSB, resp. MSB)
+	 * @param fieldDescription Field description
+	 * @param fieldRWMode Field Read/Write mode
+	 */
+	void createField(const std::string &fieldName, const std::size_t &ind1,
+			const std::size_t &ind2, const std::string &fieldDescription,
+			const ::hv::common::hvrwmode_t &fieldRWMode =
+					::hv::common::hvrwmode_t::NA);
+
+	/**
+	 * Create field in all elements without description
+	 * @param fieldName Field name
+	 * @param ind1 Starting index (MSB, resp. LSB)
+	 * @param ind2 Ending index (LSB, resp. MSB)
+	 * @param fieldRWMode Field Read/Write mode
+	 */
+	void createField(const std::string &fieldName, const std::size_t &ind1,
+			const std::size_t &ind2, const ::hv::common::hvrwmode_t &fieldRWMode =
+					::hv::common::hvrwmode_t::NA);
+
+//** Element values **//
+	/**
+	 * Get element value
+	 * @param index Element index
+	 * @return Element value
+	 */
+	::hv::common::hvuint64_t getValue(const std::size_t &index) const;
+
+	/**
+	 * Set element value (truncated to element size)
+	 * @param index Element index
+	 * @param value Element value
+	 */
+	void setValue(const std::size_t &index,
+			const ::hv::common::hvuint64_t &value);
+
+	/**
+	 * Get field value of an element
+	 * @param index Element index
+	 * @param fieldName Field name
+	 * @return Field value
+	 */
+	::hv::common::hvuint64_t getFieldValue(const std::size_t &index,
+			const std::string &fieldName) const;
+
+	/**
+	 * Set field value of an element
+	 * @param index Element index
+	 * @param fieldName Field name
+	 * @param value Field value (truncated to field size)
+	 */
+	void setFieldValue(const std::size_t &index, const std::string &fieldName,
+			const ::hv::common::hvuint64_t &value);
+
+	/**
+	 * Reset all elements
+	 */
+	void reset();
+
+//** Element access **//
+	/**
+	 * Read element, applying read mask and callbacks
+	 * @param index Element index
+	 * @param value Read value
+	 * @return true if success
+	 */
+	bool readElement(const std::size_t &index,
+			::hv::common::hvuint64_t &value);
+
+	/**
+	 * Write element, applying write mask and callbacks
+	 * @param index Element index
+	 * @param value Written value
+	 * @return true if success
+	 */
+	bool writeElement(const std::size_t &index,
+			const ::hv::common::hvuint64_t &value);
+
+//** Callbacks **//
+	/**
+	 * Register a callback on accesses to a range of elements
+	 * @param phase Access phase
+	 * @param cb Callback
+	 * @param first First element index
+	 * @param last Last element index (included)
+	 * @return Callback ID
+	 */
+	::hv::common::hvcbID_t registerCallback(const RegisterArrayPhase &phase,
+			const RegisterArrayCallback &cb, const std::size_t &first = 0u,
+			const std::size_t &last = ~std::size_t(0u));
+
+	/**
+	 * Unregister a callback
+	 * @param id Callback ID
+	 * @return true if callback was found, false else
+	 */
+	bool unregisterCallback(const ::hv::common::hvcbID_t &id);
+
+	std::size_t howManyCallbacks() const;
+
+//** Read/Write **//
+	/**
+	 * Read data from array
+	 *
+	 * Access can cover several elements. Padding between elements reads
+	 * as zero.
+	 * @param offset Offset from array start
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes
+	 * @return true if success, false if a callback vetoed an element read
+	 */
+	bool read(const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvuint8_t* readBuff, const std::size_t &readSize)
+					override;
+
+	/**
+	 * Write data to array
+	 *
+	 * Access can cover several elements, partially written elements keep
+	 * their other bytes. Writes to padding are ignored.
+	 * @param offset Offset from array start
+	 * @param writeBuff Write buffer
+	 * @param writeSize Write size in bytes
+	 * @return true if success, false if a callback vetoed an element write
+	 */
+	bool write(const ::hv::common::hvaddr_t &offset,
+			const ::hv::common::hvuint8_t* writeBuff,
+			const std::size_t &writeSize) override;
+
+//** Debug access **//
+	void debugRead(const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvuint8_t* readBuff, const std::size_t &readSize) const
+					override;
+
+	void debugWrite(const ::hv::common::hvaddr_t &offset,
+			const ::hv::common::hvuint8_t* writeBuff,
+			const std::size_t &writeSize) override;
+
+protected:
+	/**
+	 * Registered callback
+	 */
+	struct CallbackEntry {
+		::hv::common::hvcbID_t id;
+		RegisterArrayPhase phase;
+		std::size_t first;
+		std::size_t last;
+		RegisterArrayCallback cb;
+	};
+
+	/**
+	 * Check element index, exits if out of range
+	 * @param index Element index
+	 */
+	void checkIndex(const std::size_t &index) const;
+
+	/**
+	 * Get word mask of a field
+	 * @param fieldName Field name
+	 * @param low Set to field LSB index
+	 * @return Field mask, right-aligned
+	 */
+	::hv::common::hvuint64_t getFieldMask(const std::string &fieldName,
+			std::size_t &low) const;
+
+	/**
+	 * Update read and write masks from layout
+	 */
+	void updateMasks();
+
+	/**
+	 * Call callbacks of a phase covering an element, in registration order
+	 * @param phase Access phase
+	 * @param index Element index
+	 * @param oldValue Element value before access
+	 * @param newValue Element value after access
+	 * @return false if a callback vetoed the access, true else
+	 */
+	bool dispatch(const RegisterArrayPhase &phase, const std::size_t &index,
+			const ::hv::common::hvuint64_t &oldValue,
+			const ::hv::common::hvuint64_t &newValue);
+
+	/**
+	 * Element layout (one Register for all elements)
+	 */
+	Register layout;
+
+	const std::size_t nElements;
+
+	const std::size_t elementSizeInBytes;
+
+	const std::size_t stride;
+
+	/**
+	 * Ones on element size
+	 */
+	const ::hv::common::hvuint64_t valueMask;
+
+	const ::hv::common::hvuint64_t resetVal;
+
+	::hv::common::hvuint64_t readMask, writeMask;
+
+	/**
+	 * Element values, packed on elementSizeInBytes bytes each (LSB first)
+	 */
+	std::vector<::hv::common::hvuint8_t> values;
+
+	std::vector<CallbackEntry> callbacks;
+
+	::hv::common::hvcbID_t nextId;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTER_ARRAY_H_ */
@@ -0,0 +1,108 @@
+/**
+ * @file register_pattern.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register path pattern
+ */
+
+#include <cstring>
+
+#include "register_pattern.h"
+
+namespace hv {
+namespace reg {
+
+RegisterPattern::RegisterPattern(const std::string &patternIn,
+		const Syntax &syntaxIn) :
+		pattern(patternIn), syntax(syntaxIn), literal(false) {
+	if (syntax == GLOB) {
+		std::size_t end(pattern.find_first_of("*?"));
+		literal = (end == std::string::npos);
+		literalPrefix = pattern.substr(0, end);
+		return;
+	}
+	try {
+		regex = std::make_shared<std::regex>(pattern,
+				std::regex::ECMAScript | std::regex::optimize);
+	} catch (const std::regex_error &e) {
+		HV_ERR("Invalid register pattern \"" << pattern << "\": " << e.what())
+		exit(EXIT_FAILURE);
+	}
+	// Alternatives at top level have no common prefix
+	if (pattern.find('|') != std::string::npos) {
+		return;
+	}
+	std::size_t end(0u);
+	while ((end < pattern.size())
+			&& !std::strchr("\\^$.|?*+()[]{}", pattern[end])) {
+		end++;
+	}
+	// A quantifier applies to last literal character
+	if ((end < pattern.size()) && (end > 0u)
+			&& std::strchr("?*{", pattern[end])) {
+		end--;
+	}
+	literalPrefix = pattern.substr(0, end);
+}
+
+RegisterPattern::~RegisterPattern() {
+}
+
+bool RegisterPattern::matches(const std::string &path) const {
+	if (path.compare(0, literalPrefix.size(), literalPrefix) != 0) {
+		return false;
+	}
+	if (syntax == REGEX) {
+		return std::regex_match(path, *regex);
+	}
+	if (literal) {
+		return path.size() == pattern.size();
+	}
+	return globMatch(pattern.c_str() + literalPrefix.size(),
+			path.c_str() + literalPrefix.size());
+}
+
+std::string RegisterPattern::getPattern() const {
+	return pattern;
+}
+
+RegisterPattern::Syntax RegisterPattern::getSyntax() const {
+	return syntax;
+}
+
+const std::string& RegisterPattern::getLiteralPrefix() const {
+	return literalPrefix;
+}
+
+bool RegisterPattern::isLiteral() const {
+	return literal;
+}
+
+bool RegisterPattern::globMatch(const char *pat, const char *str) {
+	const char *starPat(nullptr);
+	const char *starStr(nullptr);
+	while (*str) {
+		if (*pat == '*') {
+			starPat = ++pat;
+			starStr = str;
+		} else if ((*pat == '?') || (*pat == *str)) {
+			pat++;
+			str++;
+		} else if (starPat) {
+			// Last star absorbs one more character
+			pat = starPat;
+			str = ++starStr;
+		} else {
+			return false;
+		}
+	}
+	while (*pat == '*') {
+		pat++;
+	}
+	return !*pat;
+}
+
+} // namespace reg
+} // namespace hv
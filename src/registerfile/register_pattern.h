@@ -0,0 +1,99 @@
+/**
+ * @file register_pattern.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register path pattern
+ */
+
+#ifndef HV_REGISTER_PATTERN_H_
+#define HV_REGISTER_PATTERN_H_
+
+#include <memory>
+#include <regex>
+#include <string>
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+/**
+ * RegisterPattern class
+ *
+ * Pattern matched against hierarchical register paths (register file names
+ * and register name separated by dots, e.g. "uart0.INT_STATUS"), relatively
+ * to the register file it is resolved in.
+ * Glob patterns support '*' (any sequence, dots included) and '?' (any
+ * character). Regex patterns use ECMAScript syntax and must match the whole
+ * path. Patterns are compiled once, at construction.
+ */
+class RegisterPattern {
+public:
+	enum Syntax {
+		GLOB = 0, REGEX = 1
+	};
+
+//** Constructors **//
+	/**
+	 * RegisterPattern constructor
+	 * @param patternIn Pattern
+	 * @param syntaxIn Pattern syntax
+	 */
+	RegisterPattern(const std::string &patternIn, const Syntax &syntaxIn = GLOB);
+
+//** Destructor **//
+	virtual ~RegisterPattern();
+
+//** Matching **//
+	/**
+	 * Check if a register path matches pattern
+	 * @param path Register path
+	 * @return true if path matches, false else
+	 */
+	bool matches(const std::string &path) const;
+
+//** Accessors **//
+	std::string getPattern() const;
+
+	Syntax getSyntax() const;
+
+	/**
+	 * Get literal prefix of pattern: all matching paths start with it
+	 * @return Literal prefix, empty if pattern starts with a wildcard
+	 */
+	const std::string& getLiteralPrefix() const;
+
+	/**
+	 * Check if pattern has no wildcard
+	 * @return true if only paths equal to pattern match, false else
+	 */
+	bool isLiteral() const;
+
+protected:
+	/**
+	 * Glob matching with backtracking on last star only
+	 * @param pat Glob pattern
+	 * @param str String to match
+	 * @return true if str matches pat, false else
+	 */
+	static bool globMatch(const char *pat, const char *str);
+
+	std::string pattern;
+
+	Syntax syntax;
+
+	std::string literalPrefix;
+
+	bool literal;
+
+	/**
+	 * Compiled regex (REGEX syntax only), shared by pattern copies
+	 */
+	std::shared_ptr<std::regex> regex;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTER_PATTERN_H_ */
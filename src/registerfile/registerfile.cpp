@@ -16,8 +16,12 @@ namespace reg {
 
 RegisterFile::RegisterFile(std::string nameIn, std::string descriptionIn,
 		std::size_t alignmentIn) :
-		name(nameIn), description(descriptionIn), alignment(alignmentIn), fixedSize(
-				0) {
+		name(nameIn), description(descriptionIn), alignment(alignmentIn), accessStatisticsEnabled(
+				false), traceRecorder(nullptr), coalescer(nullptr), workerPool(nullptr), maxRegisterSize(
+				0), maxRegisterFileSize(0), maxWindowSize(0), maxRegionSize(0), revision(
+				0u), decoders(
+				std::make_shared<std::vector<RegisterFile*> >(1u, this)), nextBindingId(
+				0u), fixedSize(0) {
 	if ((alignment != std::size_t(0))
 			&& (alignmentIn != superiorPowerOf2(alignmentIn))) {
 		HV_ERR("Alignment must be a power of 2")
@@ -26,8 +30,12 @@ RegisterFile::RegisterFile(std::string nameIn, std::string descriptionIn,
 }
 
 RegisterFile::RegisterFile(const RegisterFile &src) :
-		name(src.name), description(src.description), alignment(src.alignment), fixedSize(
-				src.fixedSize) {
+		name(src.name), description(src.description), alignment(src.alignment), accessStatisticsEnabled(
+				false), traceRecorder(nullptr), coalescer(nullptr), workerPool(nullptr), maxRegisterSize(
+				0), maxRegisterFileSize(0), maxWindowSize(0), maxRegionSize(0), revision(
+				0u), decoders(
+				std::make_shared<std::vector<RegisterFile*> >(1u, this)), nextBindingId(
+				0u), fixedSize(src.fixedSize) {
 	// Copying registers
 	for (rmap_t::const_iterator it = src.registers.cbegin();
 			it != src.registers.cend(); ++it) {
@@ -42,9 +50,37 @@ RegisterFile::RegisterFile(const RegisterFile &src) :
 		this->addRegisterFile(it->first, *regFileTmp);
 		this->regFilesToDelete.push_back(regFileTmp);
 	}
+	// Copying banked windows
+	for (wmap_t::const_iterator it = src.bankedWindows.cbegin();
+			it != src.bankedWindows.cend(); ++it) {
+		std::vector<RegisterFile*> banksTmp;
+		for (std::size_t i = 0; i < it->second->banks.size(); i++) {
+			banksTmp.push_back(new RegisterFile(*it->second->banks[i]));
+			this->regFilesToDelete.push_back(banksTmp.back());
+		}
+		this->addBankedWindow(it->first, banksTmp);
+		this->bankedWindows[it->first]->active = it->second->active;
+	}
+	// Regions are mapped by reference
+	for (armap_t::const_iterator it = src.regions.cbegin();
+			it != src.regions.cend(); ++it) {
+		this->addRegion(it->first, it->second);
+	}
 }
 
 RegisterFile::~RegisterFile() {
+	for (wmap_t::iterator it = allBankedWindows.begin();
+			it != allBankedWindows.end(); ++it) {
+		std::vector<RegisterFile*> &owners = it->second->owners;
+		owners.erase(std::remove(owners.begin(), owners.end(), this),
+				owners.end());
+	}
+	for (std::size_t i = 0; i < hierarchyDecoders.size(); i++) {
+		std::vector<RegisterFile*> &decodersTmp = *hierarchyDecoders[i];
+		decodersTmp.erase(
+				std::remove(decodersTmp.begin(), decodersTmp.end(), this),
+				decodersTmp.end());
+	}
 	for (std::vector<Register*>::iterator it = regsToDelete.begin();
 			it != regsToDelete.end(); it++) {
 		delete *it;
@@ -72,7 +108,12 @@ std::size_t RegisterFile::getFixedSize() const {
 }
 
 bool RegisterFile::isEmpty() const {
-	return (registers.empty() && registerFiles.empty());
+	return (registers.empty() && registerFiles.empty() && bankedWindows.empty()
+			&& regions.empty());
+}
+
+hvuint64_t RegisterFile::getRevision() const {
+	return revision;
 }
 
 hvaddr_t RegisterFile::getEndAddress(const hvaddr_t &startAddr,
@@ -108,31 +149,96 @@ hvaddr_t RegisterFile::getLastOccupiedAddress() const {
 			ret = tmp;
 		}
 	}
+	// Checking in banked windows
+	if (!bankedWindows.empty()) {
+		wmap_t::const_iterator it3 = --bankedWindows.cend();
+		hvaddr_t tmp(getEndAddress(it3->first, it3->second->size));
+		if (ret < tmp) {
+			ret = tmp;
+		}
+	}
+	// Checking in regions
+	if (!regions.empty()) {
+		armap_t::const_iterator it4 = --regions.cend();
+		hvaddr_t tmp(getEndAddress(it4->first, it4->second.getSizeInBytes()));
+		if (ret < tmp) {
+			ret = tmp;
+		}
+	}
 	return ret;
 }
 
 bool RegisterFile::isSpaceFree(const hvaddr_t &startAddr,
 		const std::size_t &blockSize) const {
+	// Maps are sorted by start address: only the first element starting from
+	// startAddr and the elements starting less than the largest element size
+	// of their map before startAddr can recover the block
 	// Checking in register files map
 	// We suppose a free space in an inner RegisterFile is not free for insertion
-	for (rfmap_t::const_iterator it = registerFiles.cbegin();
-			it != registerFiles.cend(); ++it) {
-		hvaddr_t startAddrTmp = it->first;
-		std::size_t sizeTmp = it->second.fixedSize;
-		if (recover(startAddr, blockSize, startAddrTmp, sizeTmp)) {
+	rfmap_t::const_iterator itRF = registerFiles.lower_bound(startAddr);
+	if ((itRF != registerFiles.cend())
+			&& recover(startAddr, blockSize, itRF->first,
+					itRF->second.fixedSize)) {
+		return false;
+	}
+	while (itRF != registerFiles.cbegin()) {
+		--itRF;
+		if (itRF->first + maxRegisterFileSize <= startAddr) {
+			break;
+		}
+		if (recover(startAddr, blockSize, itRF->first,
+				itRF->second.fixedSize)) {
 			return false;
 		}
-
 	}
 	// Checking in registers map
-	for (rmap_t::const_iterator it = registers.begin(); it != registers.end();
-			++it) {
-		hvaddr_t startAddrTmp = it->first;
-		std::size_t sizeTmp = it->second.getSizeInBytes();
-		if (recover(startAddr, blockSize, startAddrTmp, sizeTmp)) {
+	rmap_t::const_iterator itR = registers.lower_bound(startAddr);
+	if ((itR != registers.cend())
+			&& recover(startAddr, blockSize, itR->first,
+					itR->second.getSizeInBytes())) {
+		return false;
+	}
+	while (itR != registers.cbegin()) {
+		--itR;
+		if (itR->first + maxRegisterSize <= startAddr) {
+			break;
+		}
+		if (recover(startAddr, blockSize, itR->first,
+				itR->second.getSizeInBytes())) {
+			return false;
+		}
+	}
+	// Checking in banked windows map
+	wmap_t::const_iterator itW = bankedWindows.lower_bound(startAddr);
+	if ((itW != bankedWindows.cend())
+			&& recover(startAddr, blockSize, itW->first, itW->second->size)) {
+		return false;
+	}
+	while (itW != bankedWindows.cbegin()) {
+		--itW;
+		if (itW->first + maxWindowSize <= startAddr) {
+			break;
+		}
+		if (recover(startAddr, blockSize, itW->first, itW->second->size)) {
+			return false;
+		}
+	}
+	// Checking in regions map
+	armap_t::const_iterator itA = regions.lower_bound(startAddr);
+	if ((itA != regions.cend())
+			&& recover(startAddr, blockSize, itA->first,
+					itA->second.getSizeInBytes())) {
+		return false;
+	}
+	while (itA != regions.cbegin()) {
+		--itA;
+		if (itA->first + maxRegionSize <= startAddr) {
+			break;
+		}
+		if (recover(startAddr, blockSize, itA->first,
+				itA->second.getSizeInBytes())) {
 			return false;
 		}
-
 	}
 	// If we are here, space is free
 	return true;
@@ -183,9 +289,22 @@ bool RegisterFile::addRegister(const hvaddr_t &insertAddr, Register &reg) {
 	std::pair<rmap_t::iterator, bool> ret = registers.insert(
 			std::pair<hvaddr_t, Register&>(insertAddr, reg));
 	// Inserting in list of all registers
-	if (ret.second)
+	if (ret.second) {
+		maxRegisterSize = HV_MAX(maxRegisterSize, reg.getSizeInBytes());
+		revision++;
 		ret = allRegisters.insert(
 				std::pair<hvaddr_t, Register&>(insertAddr, reg));
+	}
+	if (ret.second)
+		this->indexRegister(reg.getName(), insertAddr, reg);
+	if (ret.second && accessStatisticsEnabled)
+		this->attachAccessCounters(reg);
+	if (ret.second && traceRecorder)
+		reg.setTraceRecorder(traceRecorder, insertAddr);
+	if (ret.second && coalescer)
+		reg.setPostWriteCoalescer(coalescer);
+	if (ret.second && workerPool)
+		reg.setCallbackWorkerPool(workerPool);
 	return ret.second;
 }
 
@@ -395,6 +514,8 @@ bool RegisterFile::addRegisterFile(const hvaddr_t &insertAddr,
 	std::pair<rfmap_t::iterator, bool> ret = registerFiles.insert(
 			std::pair<hvaddr_t, RegisterFile&>(insertAddr, regFile));
 	if (ret.second) {
+		maxRegisterFileSize = HV_MAX(maxRegisterFileSize, sizeTmp);
+		revision++;
 		/*
 		 * Adding all registers in the hierarchy of added
 		 * register file to allRegisters map
@@ -409,11 +530,568 @@ bool RegisterFile::addRegisterFile(const hvaddr_t &insertAddr,
 				HV_WARN("Problem reading hierarchy of inserted register file")
 				return false;
 			}
+			if (accessStatisticsEnabled) {
+				this->attachAccessCounters(it->second);
+			}
+			if (traceRecorder) {
+				it->second.setTraceRecorder(traceRecorder,
+						it->first + insertAddr);
+			}
+			if (coalescer) {
+				it->second.setPostWriteCoalescer(coalescer);
+			}
+			if (workerPool) {
+				it->second.setCallbackWorkerPool(workerPool);
+			}
 		}
+		// Paths of inserted hierarchy are prefixed by register file name
+		for (std::multimap<std::string, hvaddr_t>::const_iterator it =
+				regFile.registerPaths.cbegin();
+				it != regFile.registerPaths.cend(); ++it) {
+			this->indexRegister(regFile.getName() + "." + it->first,
+					it->second + insertAddr,
+					regFile.allRegisters.at(it->second));
+		}
+		// Banked windows of inserted hierarchy are decoded here as well
+		for (wmap_t::iterator it = regFile.allBankedWindows.begin();
+				it != regFile.allBankedWindows.end(); ++it) {
+			allBankedWindows[it->first + insertAddr] = it->second;
+			it->second->owners.push_back(this);
+		}
+		// Regions of inserted hierarchy as well
+		for (armap_t::const_iterator it = regFile.allRegions.cbegin();
+				it != regFile.allRegions.cend(); ++it) {
+			allRegions.insert(
+					std::pair<hvaddr_t, AddressRegion&>(it->first + insertAddr,
+							it->second));
+		}
+		this->decodeHierarchy(regFile);
 	}
 	return ret.second;
 }
 
+bool RegisterFile::addBankedWindow(const hvaddr_t &insertAddr,
+		const std::vector<RegisterFile*> &banks) {
+	// Checking if current RegisterFile is not locked
+	if (this->fixedSize != std::size_t(0)) {
+		HV_WARN(
+				"Impossible to add a banked window (RegisterFile locked after first insertion)")
+		return false;
+	}
+	if (banks.empty()) {
+		HV_WARN("A banked window needs at least one bank")
+		return false;
+	}
+	// Window size is the one of largest bank
+	std::size_t sizeTmp(0u);
+	for (std::size_t i = 0; i < banks.size(); i++) {
+		if (banks[i]->getAlignment() != this->alignment) {
+			HV_WARN(
+					"Alignment in banks must be the same than their container's alignment")
+			return false;
+		}
+		std::size_t bankSize =
+				banks[i]->fixedSize ? banks[i]->fixedSize :
+				banks[i]->isEmpty() ?
+						std::size_t(0) :
+						static_cast<std::size_t>(banks[i]->getLastOccupiedAddress()
+								+ 1);
+		sizeTmp = HV_MAX(sizeTmp, bankSize);
+	}
+	if (sizeTmp == std::size_t(0)) {
+		HV_WARN("Banked window insertion attempt with empty banks")
+		return false;
+	}
+	if (!isAligned(insertAddr, this->alignment ? this->alignment : sizeTmp)) {
+		HV_WARN("Banked window insertion attempt to unaligned address")
+		return false;
+	}
+	if (!isSpaceFree(insertAddr, sizeTmp)) {
+		HV_WARN("Space is not free for banked window insertion")
+		return false;
+	}
+	// Banks are locked as inserted register files are
+	for (std::size_t i = 0; i < banks.size(); i++) {
+		if (!banks[i]->fixedSize) {
+			banks[i]->fixedSize =
+					banks[i]->isEmpty() ?
+							std::size_t(0) :
+							static_cast<std::size_t>(banks[i]->getLastOccupiedAddress()
+									+ 1);
+		}
+	}
+	std::shared_ptr<BankedWindow> window(new BankedWindow());
+	window->size = sizeTmp;
+	window->banks = banks;
+	window->active = 0u;
+	window->owners.push_back(this);
+	window->selector = nullptr;
+	window->selectorHookId = 0u;
+	for (std::size_t i = 0; i < banks.size(); i++) {
+		this->decodeHierarchy(*banks[i]);
+	}
+	bankedWindows[insertAddr] = window;
+	allBankedWindows[insertAddr] = window;
+	maxWindowSize = HV_MAX(maxWindowSize, sizeTmp);
+	revision++;
+	return true;
+}
+
+bool RegisterFile::selectBank(const hvaddr_t &windowAddr,
+		const std::size_t &bank) {
+	wmap_t::const_iterator it = allBankedWindows.find(windowAddr);
+	if (it == allBankedWindows.cend()) {
+		HV_WARN(
+				"No banked window @" << std::hex << std::uppercase << "0x" << windowAddr)
+		return false;
+	}
+	if (!switchBank(*it->second, bank)) {
+		HV_WARN(
+				"No bank " << std::dec << bank << " in banked window @" << std::hex << std::uppercase << "0x" << windowAddr)
+		return false;
+	}
+	return true;
+}
+
+std::size_t RegisterFile::getActiveBank(const hvaddr_t &windowAddr) const {
+	wmap_t::const_iterator it = allBankedWindows.find(windowAddr);
+	if (it == allBankedWindows.cend()) {
+		HV_ERR(
+				"No banked window @" << std::hex << std::uppercase << "0x" << windowAddr)
+		exit(EXIT_FAILURE);
+	}
+	return it->second->active;
+}
+
+bool RegisterFile::setBankSelector(const hvaddr_t &windowAddr,
+		Register &selector) {
+	wmap_t::const_iterator it = allBankedWindows.find(windowAddr);
+	if (it == allBankedWindows.cend()) {
+		HV_WARN(
+				"No banked window @" << std::hex << std::uppercase << "0x" << windowAddr)
+		return false;
+	}
+	std::shared_ptr<BankedWindow> window(it->second);
+	if (window->selector != nullptr) {
+		window->selector->removeBankSelectHook(window->selectorHookId);
+	}
+	window->selector = &selector;
+	window->selectorHookId = selector.addBankSelectHook(
+			[window](const Register &reg) {
+				switchBank(*window, static_cast<hvuint64_t>(reg));
+			});
+	switchBank(*window, static_cast<hvuint64_t>(selector));
+	return true;
+}
+
+bool RegisterFile::clearBankSelector(const hvaddr_t &windowAddr) {
+	wmap_t::const_iterator it = allBankedWindows.find(windowAddr);
+	if ((it == allBankedWindows.cend()) || (it->second->selector == nullptr)) {
+		HV_WARN(
+				"No bank selector for window @" << std::hex << std::uppercase << "0x" << windowAddr)
+		return false;
+	}
+	it->second->selector->removeBankSelectHook(it->second->selectorHookId);
+	it->second->selector = nullptr;
+	return true;
+}
+
+bool RegisterFile::switchBank(BankedWindow &window, const hvuint64_t &bank) {
+	if (bank >= window.banks.size()) {
+		return false;
+	}
+	if (window.active != bank) {
+		window.active = static_cast<std::size_t>(bank);
+		for (std::size_t i = 0; i < window.owners.size(); i++) {
+			window.owners[i]->revision++;
+		}
+	}
+	return true;
+}
+
+bool RegisterFile::addAccessRule(const hvaddr_t &start, const hvaddr_t &end,
+		const AccessPermission &permission) {
+	// Checking if current RegisterFile is not locked
+	if (this->fixedSize != std::size_t(0)) {
+		HV_WARN(
+				"Impossible to add an access rule (RegisterFile locked after first insertion)")
+		return false;
+	}
+	if (end < start) {
+		HV_WARN("Access rule end address is lower than start address")
+		return false;
+	}
+	accessRules.push_back(AccessRule { start, end, permission });
+	revision++;
+	return true;
+}
+
+AccessPermission RegisterFile::getAccessPermission(
+		const hvaddr_t &address) const {
+	AccessPermission ret;
+	for (std::size_t i = 0; i < accessRules.size(); i++) {
+		if ((address >= accessRules[i].start)
+				&& (address <= accessRules[i].end)) {
+			ret.intersect(accessRules[i].permission);
+		}
+	}
+	// Rules of inserted register file containing address
+	rfmap_t::const_iterator itRF = registerFiles.upper_bound(address);
+	if (itRF != registerFiles.cbegin()) {
+		--itRF;
+		if (address < itRF->first + itRF->second.fixedSize) {
+			ret.intersect(
+					itRF->second.getAccessPermission(address - itRF->first));
+		}
+	}
+	// Rules of active bank
+	wmap_t::const_iterator itW = bankedWindows.upper_bound(address);
+	if (itW != bankedWindows.cbegin()) {
+		--itW;
+		if (address < itW->first + itW->second->size) {
+			const BankedWindow &window(*itW->second);
+			ret.intersect(
+					window.banks[window.active]->getAccessPermission(
+							address - itW->first));
+		}
+	}
+	return ret;
+}
+
+bool RegisterFile::hasAccessRules(const hvaddr_t &start,
+		const hvaddr_t &end) const {
+	for (std::size_t i = 0; i < accessRules.size(); i++) {
+		if ((accessRules[i].start <= end) && (accessRules[i].end >= start)) {
+			return true;
+		}
+	}
+	// Rules of inserted register files overlapping range
+	for (rfmap_t::const_iterator itRF = registerFiles.cbegin();
+			(itRF != registerFiles.cend()) && (itRF->first <= end); ++itRF) {
+		const hvaddr_t rfEnd(itRF->first + itRF->second.fixedSize - 1u);
+		if ((rfEnd >= start)
+				&& itRF->second.hasAccessRules(
+						HV_MAX(start, itRF->first) - itRF->first,
+						HV_MIN(end, rfEnd) - itRF->first)) {
+			return true;
+		}
+	}
+	// Rules of active banks overlapping range
+	for (wmap_t::const_iterator itW = bankedWindows.cbegin();
+			(itW != bankedWindows.cend()) && (itW->first <= end); ++itW) {
+		const BankedWindow &window(*itW->second);
+		const hvaddr_t wEnd(itW->first + window.size - 1u);
+		if ((wEnd >= start)
+				&& window.banks[window.active]->hasAccessRules(
+						HV_MAX(start, itW->first) - itW->first,
+						HV_MIN(end, wEnd) - itW->first)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+std::vector<hvaddr_t> RegisterFile::findRegisters(
+		const RegisterPattern &pattern) const {
+	std::vector<hvaddr_t> ret;
+	if (pattern.isLiteral()) {
+		std::pair<std::multimap<std::string, hvaddr_t>::const_iterator,
+				std::multimap<std::string, hvaddr_t>::const_iterator> range =
+				registerPaths.equal_range(pattern.getPattern());
+		for (std::multimap<std::string, hvaddr_t>::const_iterator it =
+				range.first; it != range.second; ++it) {
+			ret.push_back(it->second);
+		}
+		return ret;
+	}
+	// Only paths starting with literal prefix can match
+	const std::string &prefix(pattern.getLiteralPrefix());
+	for (std::multimap<std::string, hvaddr_t>::const_iterator it =
+			registerPaths.lower_bound(prefix);
+			(it != registerPaths.cend())
+					&& !it->first.compare(0, prefix.size(), prefix); ++it) {
+		if (pattern.matches(it->first)) {
+			ret.push_back(it->second);
+		}
+	}
+	return ret;
+}
+
+hvcbID_t RegisterFile::bindPreReadCallback(const RegisterPattern &pattern,
+		const PreReadCallback &cb) {
+	return this->bindCallbacks(
+			PatternBinding { pattern, [cb](Register &reg) {
+				return reg.registerPreReadCallback(cb);
+			}, [](Register &reg, const hvcbID_t &id) {
+				return reg.unregisterPreReadCallback(id);
+			}, { } });
+}
+
+hvcbID_t RegisterFile::bindPostReadCallback(const RegisterPattern &pattern,
+		const PostReadCallback &cb) {
+	return this->bindCallbacks(
+			PatternBinding { pattern, [cb](Register &reg) {
+				return reg.registerPostReadCallback(cb);
+			}, [](Register &reg, const hvcbID_t &id) {
+				return reg.unregisterPostReadCallback(id);
+			}, { } });
+}
+
+hvcbID_t RegisterFile::bindPreWriteCallback(const RegisterPattern &pattern,
+		const PreWriteCallback &cb) {
+	return this->bindCallbacks(
+			PatternBinding { pattern, [cb](Register &reg) {
+				return reg.registerPreWriteCallback(cb);
+			}, [](Register &reg, const hvcbID_t &id) {
+				return reg.unregisterPreWriteCallback(id);
+			}, { } });
+}
+
+hvcbID_t RegisterFile::bindPostWriteCallback(const RegisterPattern &pattern,
+		const PostWriteCallback &cb) {
+	return this->bindCallbacks(
+			PatternBinding { pattern, [cb](Register &reg) {
+				return reg.registerPostWriteCallback(cb);
+			}, [](Register &reg, const hvcbID_t &id) {
+				return reg.unregisterPostWriteCallback(id);
+			}, { } });
+}
+
+bool RegisterFile::unbindCallbacks(const hvcbID_t &id) {
+	std::map<hvcbID_t, PatternBinding>::iterator binding =
+			patternBindings.find(id);
+	if (binding == patternBindings.end()) {
+		return false;
+	}
+	for (std::size_t i = 0; i < binding->second.bound.size(); i++) {
+		binding->second.detach(*binding->second.bound[i].first,
+				binding->second.bound[i].second);
+	}
+	patternBindings.erase(binding);
+	return true;
+}
+
+std::size_t RegisterFile::howManyBoundRegisters(const hvcbID_t &id) const {
+	std::map<hvcbID_t, PatternBinding>::const_iterator binding =
+			patternBindings.find(id);
+	return binding == patternBindings.cend() ?
+			std::size_t(0u) : binding->second.bound.size();
+}
+
+void RegisterFile::indexRegister(const std::string &path,
+		const hvaddr_t &address, Register &reg) {
+	registerPaths.insert(std::pair<std::string, hvaddr_t>(path, address));
+	for (std::map<hvcbID_t, PatternBinding>::iterator it =
+			patternBindings.begin(); it != patternBindings.end(); ++it) {
+		if (it->second.pattern.matches(path)) {
+			it->second.bound.push_back(
+					std::make_pair(&reg, it->second.attach(reg)));
+		}
+	}
+}
+
+hvcbID_t RegisterFile::bindCallbacks(const PatternBinding &binding) {
+	const hvcbID_t id(nextBindingId++);
+	PatternBinding &bindingTmp(
+			patternBindings.insert(std::make_pair(id, binding)).first->second);
+	std::vector<hvaddr_t> addresses(this->findRegisters(binding.pattern));
+	for (std::size_t i = 0; i < addresses.size(); i++) {
+		Register &reg(allRegisters.at(addresses[i]));
+		bindingTmp.bound.push_back(std::make_pair(&reg, bindingTmp.attach(reg)));
+	}
+	return id;
+}
+
+hvcbID_t RegisterFile::registerRangeCallback(const hvaddr_t &start,
+		const hvaddr_t &end, const RangeCallbackPhase &phase,
+		const RangeCallback &cb) {
+	if (end < start) {
+		HV_ERR("Callback range end address is lower than start address")
+		exit(EXIT_FAILURE);
+	}
+	// Decode caches of all decoding register files keep track of covered addresses
+	const hvcbID_t id(rangeCallbacks.add(start, end, phase, cb));
+	this->incrementDecodersRevision();
+	return id;
+}
+
+bool RegisterFile::unregisterRangeCallback(const hvcbID_t &id) {
+	if (!rangeCallbacks.remove(id)) {
+		return false;
+	}
+	this->incrementDecodersRevision();
+	return true;
+}
+
+bool RegisterFile::hasRangeCallbacks(const hvaddr_t &address,
+		const std::size_t &size) const {
+	if (!rangeCallbacks.isEmpty() && rangeCallbacks.covers(address, size)) {
+		return true;
+	}
+	// Callbacks of inserted register file containing address
+	rfmap_t::const_iterator itRF = registerFiles.upper_bound(address);
+	if (itRF != registerFiles.cbegin()) {
+		--itRF;
+		if ((address < itRF->first + itRF->second.fixedSize)
+				&& itRF->second.hasRangeCallbacks(address - itRF->first,
+						size)) {
+			return true;
+		}
+	}
+	// Callbacks of active bank
+	wmap_t::const_iterator itW = bankedWindows.upper_bound(address);
+	if (itW != bankedWindows.cbegin()) {
+		--itW;
+		if (address < itW->first + itW->second->size) {
+			const BankedWindow &window(*itW->second);
+			return window.banks[window.active]->hasRangeCallbacks(
+					address - itW->first, size);
+		}
+	}
+	return false;
+}
+
+bool RegisterFile::dispatchRangeCallbacks(const RangeCallbackPhase &phase,
+		const hvaddr_t &address, Register &reg, const hvuint8_t *data,
+		const std::size_t &size) const {
+	bool ret(
+			rangeCallbacks.isEmpty()
+					|| rangeCallbacks.dispatch(phase, address, reg, data, size));
+	// Callbacks of inserted register file containing address
+	rfmap_t::const_iterator itRF = registerFiles.upper_bound(address);
+	if (itRF != registerFiles.cbegin()) {
+		--itRF;
+		if (address < itRF->first + itRF->second.fixedSize) {
+			ret = itRF->second.dispatchRangeCallbacks(phase,
+					address - itRF->first, reg, data, size) && ret;
+		}
+	}
+	// Callbacks of active bank
+	wmap_t::const_iterator itW = bankedWindows.upper_bound(address);
+	if (itW != bankedWindows.cbegin()) {
+		--itW;
+		if (address < itW->first + itW->second->size) {
+			const BankedWindow &window(*itW->second);
+			ret = window.banks[window.active]->dispatchRangeCallbacks(phase,
+					address - itW->first, reg, data, size) && ret;
+		}
+	}
+	return ret;
+}
+
+void RegisterFile::decodeHierarchy(RegisterFile &regFile) {
+	// Current register file is locked once inserted: it has no decoder yet
+	regFile.decoders->push_back(this);
+	hierarchyDecoders.push_back(regFile.decoders);
+	for (std::size_t i = 0; i < regFile.hierarchyDecoders.size(); i++) {
+		regFile.hierarchyDecoders[i]->push_back(this);
+		hierarchyDecoders.push_back(regFile.hierarchyDecoders[i]);
+	}
+}
+
+void RegisterFile::incrementDecodersRevision() {
+	const std::vector<RegisterFile*> decodersTmp(*decoders);
+	for (std::size_t i = 0; i < decodersTmp.size(); i++) {
+		decodersTmp[i]->revision++;
+	}
+}
+
+RegisterFile::wmap_t::const_iterator RegisterFile::findBankedWindow(
+		const hvaddr_t &address) const {
+	if (allBankedWindows.empty()) {
+		return allBankedWindows.cend();
+	}
+	wmap_t::const_iterator it = allBankedWindows.upper_bound(address);
+	if (it == allBankedWindows.cbegin()) {
+		return allBankedWindows.cend();
+	}
+	--it;
+	if (address >= it->first + it->second->size) {
+		return allBankedWindows.cend();
+	}
+	return it;
+}
+
+bool RegisterFile::addRegion(const hvaddr_t &insertAddr,
+		AddressRegion &region) {
+	// Checking if current RegisterFile is not locked
+	if (this->fixedSize != std::size_t(0)) {
+		HV_WARN(
+				"Impossible to add a region (RegisterFile locked after first insertion)")
+		return false;
+	}
+	const std::size_t sizeTmp(region.getSizeInBytes());
+	if (sizeTmp == std::size_t(0)) {
+		HV_WARN("Region insertion attempt with empty region")
+		return false;
+	}
+	if (!isAligned(insertAddr, this->alignment ? this->alignment : sizeTmp)) {
+		HV_WARN("Region insertion attempt to unaligned address")
+		return false;
+	}
+	if (!isSpaceFree(insertAddr, sizeTmp)) {
+		HV_WARN("Space is not free for region insertion")
+		return false;
+	}
+	regions.insert(std::pair<hvaddr_t, AddressRegion&>(insertAddr, region));
+	allRegions.insert(std::pair<hvaddr_t, AddressRegion&>(insertAddr, region));
+	maxRegionSize = HV_MAX(maxRegionSize, sizeTmp);
+	revision++;
+	return true;
+}
+
+bool RegisterFile::addRegion(AddressRegion &region) {
+	const std::size_t sizeTmp(region.getSizeInBytes());
+	hvaddr_t insertAddr(
+			this->isEmpty() ?
+					static_cast<hvaddr_t>(0) :
+					this->getLastOccupiedAddress() + 1);
+	insertAddr = this->getNearestSuperiorAlignedAddress(insertAddr,
+			this->alignment ? this->alignment : sizeTmp);
+	return this->addRegion(insertAddr, region);
+}
+
+AddressRegion* RegisterFile::tryGetRegion(const hvaddr_t &address,
+		hvaddr_t *offset) const {
+	armap_t::const_iterator it = allRegions.upper_bound(address);
+	if (it != allRegions.cbegin()) {
+		--it;
+		if (address < it->first + it->second.getSizeInBytes()) {
+			if (offset != nullptr) {
+				*offset = address - it->first;
+			}
+			return &it->second;
+		}
+	}
+	// Region may be in active bank of a banked window
+	wmap_t::const_iterator winIt = this->findBankedWindow(address);
+	if (winIt == this->allBankedWindows.cend()) {
+		return nullptr;
+	}
+	const BankedWindow &window(*winIt->second);
+	return window.banks[window.active]->tryGetRegion(address - winIt->first,
+			offset);
+}
+
+hvaddr_t RegisterFile::getRegionAddress(const std::string &name) const {
+	for (armap_t::const_iterator it = allRegions.cbegin();
+			it != allRegions.cend(); ++it) {
+		if (it->second.getName() == name) {
+			return it->first;
+		}
+	}
+	HV_ERR("No region named " << name << " in register file")
+	exit(EXIT_FAILURE);
+}
+
+AddressRegion& RegisterFile::getRegion(const std::string &name) const {
+	return allRegions.at(this->getRegionAddress(name));
+}
+
+const RegisterFile::armap_t& RegisterFile::getAllRegions() const {
+	return allRegions;
+}
+
 bool RegisterFile::addRegisterFile(RegisterFile &regFile) {
 	return this->addRegisterFile(regFile, std::size_t(0));
 }
@@ -481,14 +1159,52 @@ hvaddr_t RegisterFile::getRegisterFileAddress(const std::string &name) const {
 }
 
 Register& RegisterFile::getRegister(const hvaddr_t &address) const {
-	rmap_t::const_iterator regIt = this->allRegisters.find(address);
-	if (regIt == this->allRegisters.end()) {
+	Register* ret = this->tryGetRegister(address);
+	if (ret == nullptr) {
 		// Definitely not found.
 		HV_ERR("No register @" << std::hex << std::uppercase << "0x" << address);
 		exit(EXIT_FAILURE);
 	}
-	Register& ret = regIt->second;
-	return ret;
+	return *ret;
+}
+
+Register* RegisterFile::tryGetRegister(const hvaddr_t &address) const {
+	rmap_t::const_iterator regIt = this->allRegisters.find(address);
+	if (regIt == this->allRegisters.cend()) {
+		// Register may be in active bank of a banked window
+		wmap_t::const_iterator winIt = this->findBankedWindow(address);
+		if (winIt == this->allBankedWindows.cend()) {
+			return nullptr;
+		}
+		const BankedWindow &window(*winIt->second);
+		return window.banks[window.active]->tryGetRegister(
+				address - winIt->first);
+	}
+	return &regIt->second;
+}
+
+Register* RegisterFile::tryGetEnclosingRegister(const hvaddr_t &address,
+		hvaddr_t *offset) const {
+	// Registers do not overlap: only the last one starting at or before
+	// address can contain it
+	rmap_t::const_iterator regIt = this->allRegisters.upper_bound(address);
+	if (regIt != this->allRegisters.cbegin()) {
+		--regIt;
+		if (address < regIt->first + regIt->second.getSizeInBytes()) {
+			if (offset != nullptr) {
+				*offset = address - regIt->first;
+			}
+			return &regIt->second;
+		}
+	}
+	// Register may be in active bank of a banked window
+	wmap_t::const_iterator winIt = this->findBankedWindow(address);
+	if (winIt == this->allBankedWindows.cend()) {
+		return nullptr;
+	}
+	const BankedWindow &window(*winIt->second);
+	return window.banks[window.active]->tryGetEnclosingRegister(
+			address - winIt->first, offset);
 }
 
 Register& RegisterFile::getRegister(const std::string &name) const {
@@ -509,6 +1225,10 @@ RegisterFile& RegisterFile::getRegisterFile(const std::string &name) const {
 	return this->getRegisterFile(addrTmp);
 }
 
+const RegisterFile::rmap_t& RegisterFile::getAllRegisters() const {
+	return this->allRegisters;
+}
+
 Register& RegisterFile::operator()(const hvaddr_t &address) const {
 	return this->getRegister(address);
 }
@@ -527,14 +1247,208 @@ RegisterFile& RegisterFile::operator [](const std::string &name) const {
 
 bool RegisterFile::read(const hvaddr_t &address, hvuint8_t* readBuff,
 		const std::size_t &readSize) {
-	Register &retTmp = this->getRegister(address);
-	return retTmp.read(readBuff, readSize);
+	Register *reg(this->tryGetRegister(address));
+	if (reg == nullptr) {
+		hvaddr_t offset;
+		AddressRegion *region(this->tryGetRegion(address, &offset));
+		if (region != nullptr) {
+			return region->read(offset, readBuff, readSize);
+		}
+	}
+	Register &retTmp = reg ? *reg : this->getRegister(address);
+	if (!this->hasRangeCallbacks(address, readSize)) {
+		return retTmp.read(readBuff, readSize);
+	}
+	if (!this->dispatchRangeCallbacks(RANGE_PRE_READ, address, retTmp,
+			readBuff, readSize) || !retTmp.read(readBuff, readSize)) {
+		return false;
+	}
+	this->dispatchRangeCallbacks(RANGE_POST_READ, address, retTmp, readBuff,
+			readSize);
+	return true;
 }
 
 bool RegisterFile::write(const hvaddr_t &address, const hvuint8_t* writeBuff,
 		const std::size_t &writeSize) {
-	Register &retTmp = this->getRegister(address);
-	return retTmp.write(writeBuff, writeSize);
+	Register *reg(this->tryGetRegister(address));
+	if (reg == nullptr) {
+		hvaddr_t offset;
+		AddressRegion *region(this->tryGetRegion(address, &offset));
+		if (region != nullptr) {
+			return region->write(offset, writeBuff, writeSize);
+		}
+	}
+	Register &retTmp = reg ? *reg : this->getRegister(address);
+	if (!this->hasRangeCallbacks(address, writeSize)) {
+		return retTmp.write(writeBuff, writeSize);
+	}
+	if (!this->dispatchRangeCallbacks(RANGE_PRE_WRITE, address, retTmp,
+			writeBuff, writeSize) || !retTmp.write(writeBuff, writeSize)) {
+		return false;
+	}
+	this->dispatchRangeCallbacks(RANGE_POST_WRITE, address, retTmp,
+			writeBuff, writeSize);
+	return true;
+}
+
+void RegisterFile::enableAccessStatistics() {
+#ifdef HV_REG_DISABLE_STATISTICS
+	HV_WARN("Access statistics of " << name << " are compiled out (ENABLE_REGISTER_STATISTICS=OFF)")
+	return;
+#endif
+	if (accessStatisticsEnabled) {
+		return;
+	}
+	accessStatisticsEnabled = true;
+	accessCounters = std::make_shared<std::vector<RegisterAccessCounters> >();
+	accessCounters->reserve(allRegisters.size());
+	for (rmap_t::iterator it = allRegisters.begin(); it != allRegisters.end();
+			++it) {
+		this->attachAccessCounters(it->second);
+	}
+}
+
+void RegisterFile::disableAccessStatistics() {
+	for (std::size_t i = 0; i < countedRegisters.size(); i++) {
+		// Only detaching counters still owned by this register file
+		if (countedRegisters[i]->getAccessCounters()
+				== &(*accessCounters)[i]) {
+			countedRegisters[i]->setAccessCounters(nullptr);
+		}
+	}
+	countedRegisters.clear();
+	accessCounters.reset();
+	accessStatisticsEnabled = false;
+}
+
+bool RegisterFile::isAccessStatisticsEnabled() const {
+	return accessStatisticsEnabled;
+}
+
+void RegisterFile::resetAccessStatistics() {
+	if (accessCounters == nullptr) {
+		return;
+	}
+	for (std::size_t i = 0; i < accessCounters->size(); i++) {
+		(*accessCounters)[i].reset();
+	}
+}
+
+const RegisterAccessCounters* RegisterFile::getAccessStatistics(
+		const hvaddr_t &address) const {
+	rmap_t::const_iterator it = allRegisters.find(address);
+	if (it == allRegisters.cend()) {
+		return nullptr;
+	}
+	return it->second.getAccessCounters();
+}
+
+std::vector<std::pair<hvaddr_t, RegisterAccessCounters> > RegisterFile::getHottestRegisters(
+		const std::size_t &n) const {
+	typedef std::pair<hvaddr_t, RegisterAccessCounters> stat_t;
+	std::vector<stat_t> ret;
+#ifdef HV_REG_DISABLE_STATISTICS
+	HV_WARN("Access statistics of " << name << " are compiled out (ENABLE_REGISTER_STATISTICS=OFF)")
+	return ret;
+#endif
+	for (rmap_t::const_iterator it = allRegisters.cbegin();
+			it != allRegisters.cend(); ++it) {
+		const RegisterAccessCounters *counters =
+				it->second.getAccessCounters();
+		if (counters != nullptr && counters->getAccesses()) {
+			ret.push_back(stat_t(it->first, *counters));
+		}
+	}
+	std::size_t nTmp = HV_MIN(n, ret.size());
+	std::partial_sort(ret.begin(), ret.begin() + nTmp, ret.end(),
+			[](const stat_t &a, const stat_t &b) {
+				return a.second.getAccesses() > b.second.getAccesses();
+			});
+	ret.resize(nTmp);
+	return ret;
+}
+
+std::string RegisterFile::getAccessStatisticsReport(const std::size_t &n) const {
+	std::vector<std::pair<hvaddr_t, RegisterAccessCounters> > hottest =
+			this->getHottestRegisters(n);
+	std::stringstream ret, tmp;
+	TextTable t('-', '|', '+');
+	t.add("Rel. address");
+	t.add("Name");
+	t.add("Reads");
+	t.add("Writes");
+	t.add("Read vetoes");
+	t.add("Write vetoes");
+	t.add("Bytes read");
+	t.add("Bytes written");
+	t.endOfRow();
+	for (std::vector<std::pair<hvaddr_t, RegisterAccessCounters> >::const_iterator it =
+			hottest.cbegin(); it != hottest.cend(); ++it) {
+		tmp << std::hex << std::uppercase << "0x" << it->first;
+		t.add(tmp.str());
+		tmp.str("");
+		tmp.clear();
+		t.add(this->getRegister(it->first).getName());
+		t.add(std::to_string(it->second.reads));
+		t.add(std::to_string(it->second.writes));
+		t.add(std::to_string(it->second.readVetoes));
+		t.add(std::to_string(it->second.writeVetoes));
+		t.add(std::to_string(it->second.bytesRead));
+		t.add(std::to_string(it->second.bytesWritten));
+		t.endOfRow();
+	}
+	ret << "Register file access statistics:" << std::endl;
+	ret << "	Name: " << this->name << std::endl;
+	ret << t;
+	return ret.str();
+}
+
+void RegisterFile::setTraceRecorder(AccessTraceRecorder *recorder) {
+	traceRecorder = recorder;
+	for (rmap_t::iterator it = allRegisters.begin(); it != allRegisters.end();
+			++it) {
+		it->second.setTraceRecorder(recorder, it->first);
+	}
+}
+
+AccessTraceRecorder* RegisterFile::getTraceRecorder() const {
+	return traceRecorder;
+}
+
+void RegisterFile::setPostWriteCoalescer(PostWriteCoalescer *coalescerIn) {
+	coalescer = coalescerIn;
+	for (rmap_t::iterator it = allRegisters.begin(); it != allRegisters.end();
+			++it) {
+		it->second.setPostWriteCoalescer(coalescerIn);
+	}
+}
+
+PostWriteCoalescer* RegisterFile::getPostWriteCoalescer() const {
+	return coalescer;
+}
+
+void RegisterFile::setCallbackWorkerPool(CallbackWorkerPool *poolIn) {
+	workerPool = poolIn;
+	for (rmap_t::iterator it = allRegisters.begin(); it != allRegisters.end();
+			++it) {
+		it->second.setCallbackWorkerPool(poolIn);
+	}
+}
+
+CallbackWorkerPool* RegisterFile::getCallbackWorkerPool() const {
+	return workerPool;
+}
+
+void RegisterFile::attachAccessCounters(Register &reg) {
+#ifndef HV_REG_DISABLE_STATISTICS
+	// Counters of another register file are shared rather than replaced
+	if (reg.getAccessCounters() != nullptr) {
+		return;
+	}
+	accessCounters->push_back(RegisterAccessCounters());
+	countedRegisters.push_back(&reg);
+	reg.setAccessCounters(accessCounters, accessCounters->size() - 1u);
+#endif
 }
 
 std::string RegisterFile::getInfo() const {
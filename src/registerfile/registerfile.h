@@ -14,8 +14,14 @@
 #include <algorithm>
 #include <vector>
 #include <map>
+#include <memory>
+#include <functional>
 #include <hv/common.h>
 
+#include "access_permission.h"
+#include "address_region.h"
+#include "range_callback_map.h"
+#include "register_pattern.h"
 #include "registerfile_if.h"
 #include "../register/register.h"
 
@@ -27,6 +33,7 @@ public:
 //** Type definitions **//
 	typedef std::map<::hv::common::hvaddr_t, Register&> rmap_t;
 	typedef std::map<::hv::common::hvaddr_t, RegisterFile&> rfmap_t;
+	typedef std::map<::hv::common::hvaddr_t, AddressRegion&> armap_t;
 
 //** Constructors **//
 	/**
@@ -81,6 +88,17 @@ public:
 	 */
 	bool isEmpty() const;
 
+	/**
+	 * Get layout revision
+	 *
+	 * Revision is incremented each time a register or a register file is
+	 * inserted. Tools caching the layout (decode caches, DMI images) compare
+	 * it to detect changes. Bank switches and address-range callback changes
+	 * in inserted register files and banks increment it as well.
+	 * @return Layout revision
+	 */
+	::hv::common::hvuint64_t getRevision() const;
+
 //** Register file's memory management **//
 
 	/**
@@ -303,6 +321,286 @@ public:
 	 */
 	bool addRegisterFile(RegisterFile &regFile, const std::size_t &regFileSize);
 
+//** Banked windows **//
+	/**
+	 * Adds a banked window: register files mapped by reference to the same
+	 * address range, only one of them (the active bank) being visible
+	 *
+	 * Window size is the size of the largest bank. First bank is active.
+	 * Banks must have the same alignment as current register file.
+	 * Registers of banks are decoded by getRegister() and tryGetRegister(),
+	 * including from register files current one is later inserted in, but
+	 * are not listed by getAllRegisters(): access statistics, trace recording
+	 * and register lookup by name do not apply to them.
+	 * @param insertAddr Insertion address
+	 * @param banks Register files to map, in bank number order
+	 * @return True if window was correctly inserted, false else.
+	 */
+	bool addBankedWindow(const ::hv::common::hvaddr_t &insertAddr,
+			const std::vector<RegisterFile*> &banks);
+
+	/**
+	 * Select active bank of a banked window
+	 *
+	 * Switching bank does not move any register: it replaces the decoded bank
+	 * and increments layout revision of register files decoding the window
+	 * so that their decode caches are flushed.
+	 * @param windowAddr Window address, relatively to current register file
+	 * @param bank Bank number
+	 * @return true if success, false if there is no such window or bank
+	 */
+	bool selectBank(const ::hv::common::hvaddr_t &windowAddr,
+			const std::size_t &bank);
+
+	/**
+	 * Get active bank of a banked window
+	 * @param windowAddr Window address, relatively to current register file
+	 * @return Active bank number
+	 */
+	std::size_t getActiveBank(const ::hv::common::hvaddr_t &windowAddr) const;
+
+	/**
+	 * Select active bank of a banked window from a register value
+	 *
+	 * Bank is selected after each write of selector register and when this
+	 * method is called. Values with no corresponding bank are ignored.
+	 * Model code modifying selector without write() must call selectBank().
+	 * Selection uses a bank selection hook of selector (see
+	 * Register::addBankSelectHook()): it is not removed by callback
+	 * unregistration. Setting a new selector replaces the previous one, which
+	 * must still exist.
+	 * @param windowAddr Window address, relatively to current register file
+	 * @param selector Register holding bank number
+	 * @return true if success, false if there is no such window
+	 */
+	bool setBankSelector(const ::hv::common::hvaddr_t &windowAddr,
+			Register &selector);
+
+	/**
+	 * Detach selector register of a banked window
+	 *
+	 * Active bank is kept.
+	 * @param windowAddr Window address, relatively to current register file
+	 * @return true if success, false if there is no such window or selector
+	 */
+	bool clearBankSelector(const ::hv::common::hvaddr_t &windowAddr);
+
+//** Address regions **//
+	/**
+	 * Adds an address region (register array, memory) by reference
+	 *
+	 * Regions are decoded by RegModule transport and by read() and write(),
+	 * including from register files current one is later inserted in, but
+	 * hold no Register: register lookup, callbacks bindings, access
+	 * statistics and address-range callbacks do not apply to them. Copies of
+	 * current register file map the same regions.
+	 * @param insertAddr Insertion address
+	 * @param region Region to insert
+	 * @return True if region was correctly inserted, false else.
+	 */
+	bool addRegion(const ::hv::common::hvaddr_t &insertAddr,
+			AddressRegion &region);
+
+	/**
+	 * Adds an address region by reference with no specified address
+	 * @param region Region to insert
+	 * @return True if region was correctly inserted, false else.
+	 */
+	bool addRegion(AddressRegion &region);
+
+	/**
+	 * Get region containing an address (recursive)
+	 * @param address Address
+	 * @param offset If not nullptr, set to offset of address in region
+	 * @return Pointer to region, nullptr if no region contains address
+	 */
+	AddressRegion* tryGetRegion(const ::hv::common::hvaddr_t &address,
+			::hv::common::hvaddr_t *offset = nullptr) const;
+
+	/**
+	 * Get region address from its name
+	 *
+	 * If several regions have the same name, the address of the one
+	 * at the smallest address is returned.
+	 * @param name Region name
+	 * @return Region address
+	 */
+	::hv::common::hvaddr_t getRegionAddress(const std::string &name) const;
+
+	/**
+	 * Get reference to region from its name
+	 * @param name Region name
+	 * @return Reference to region
+	 */
+	AddressRegion& getRegion(const std::string &name) const;
+
+	/**
+	 * Get map address/region listing all descending hierarchy
+	 * @return Const reference to flattened region map
+	 */
+	const armap_t& getAllRegions() const;
+
+//** Access permissions **//
+	/**
+	 * Adds an access rule to an address range
+	 *
+	 * Accesses must be allowed by all rules covering their address, including
+	 * rules of inserted register files and active banks. Rules are checked by
+	 * RegModule transport, not by Register accesses. Rules must be added
+	 * before current register file is inserted in another one.
+	 * @param start Range start address
+	 * @param end Range end address (included)
+	 * @param permission Permission of accesses to range
+	 * @return true if success, false else
+	 */
+	bool addAccessRule(const ::hv::common::hvaddr_t &start,
+			const ::hv::common::hvaddr_t &end,
+			const AccessPermission &permission);
+
+	/**
+	 * Get access permission of an address (recursive)
+	 * @param address Address
+	 * @return Intersection of permissions of all rules covering address
+	 */
+	AccessPermission getAccessPermission(
+			const ::hv::common::hvaddr_t &address) const;
+
+	/**
+	 * Check if access rules cover part of an address range (recursive)
+	 * @param start Range start address
+	 * @param end Range end address (included)
+	 * @return true if at least one rule overlaps range
+	 */
+	bool hasAccessRules(const ::hv::common::hvaddr_t &start,
+			const ::hv::common::hvaddr_t &end) const;
+
+//** Address-range callbacks **//
+	/**
+	 * Register a callback on accesses to registers starting in an address range
+	 *
+	 * Callbacks are called for accesses decoded by current register file or
+	 * by a register file it is inserted in (directly, or as a bank of an
+	 * active banked window): read() and write() of those register files, and
+	 * RegModule transport of an address space including current register file.
+	 * A callback is called for every register access overlapping its range,
+	 * even when range starts or ends inside the register. Accesses to address
+	 * regions never call range callbacks.
+	 * Callbacks may be registered after insertion.
+	 * @param start Range start address
+	 * @param end Range end address (included)
+	 * @param phase Access phase
+	 * @param cb Callback
+	 * @return Callback ID
+	 */
+	::hv::common::hvcbID_t registerRangeCallback(
+			const ::hv::common::hvaddr_t &start,
+			const ::hv::common::hvaddr_t &end, const RangeCallbackPhase &phase,
+			const RangeCallback &cb);
+
+	/**
+	 * Unregister an address-range callback
+	 * @param id Callback ID
+	 * @return true if callback was found, false else
+	 */
+	bool unregisterRangeCallback(const ::hv::common::hvcbID_t &id);
+
+	/**
+	 * Check if address-range callbacks cover part of an access (recursive)
+	 * @param address Register address
+	 * @param size Access size in bytes
+	 * @return true if at least one callback range overlaps access, in
+	 * current register file, inserted register files or active banks
+	 */
+	bool hasRangeCallbacks(const ::hv::common::hvaddr_t &address,
+			const std::size_t &size = 1u) const;
+
+	/**
+	 * Call address-range callbacks of a phase overlapping an access
+	 * (recursive)
+	 *
+	 * Callbacks of current register file are called first, then those of
+	 * inserted register file or active bank including address, with address
+	 * relative to it.
+	 * @param phase Access phase
+	 * @param address Register address
+	 * @param reg Accessed register
+	 * @param data Access data
+	 * @param size Access size in bytes
+	 * @return false if a callback vetoed the access, true else
+	 */
+	bool dispatchRangeCallbacks(const RangeCallbackPhase &phase,
+			const ::hv::common::hvaddr_t &address, Register &reg,
+			const ::hv::common::hvuint8_t *data, const std::size_t &size) const;
+
+//** Pattern bindings **//
+	/**
+	 * Find registers whose path matches a pattern
+	 *
+	 * Paths are relative to current register file: "REG" for its registers,
+	 * "file.REG" for registers of inserted register file "file", etc.
+	 * Pattern is resolved against a sorted path index, only paths starting
+	 * with its literal prefix are matched.
+	 * @param pattern Path pattern
+	 * @return Addresses of matching registers, in path order
+	 */
+	std::vector<::hv::common::hvaddr_t> findRegisters(
+			const RegisterPattern &pattern) const;
+
+	/**
+	 * Register a pre-read callback on all registers whose path matches a
+	 * pattern, including registers inserted later in current register file
+	 * @param pattern Path pattern
+	 * @param cb Callback
+	 * @return Binding ID
+	 */
+	::hv::common::hvcbID_t bindPreReadCallback(const RegisterPattern &pattern,
+			const PreReadCallback &cb);
+
+	/**
+	 * Register a post-read callback on all registers whose path matches a
+	 * pattern (see bindPreReadCallback())
+	 * @param pattern Path pattern
+	 * @param cb Callback
+	 * @return Binding ID
+	 */
+	::hv::common::hvcbID_t bindPostReadCallback(const RegisterPattern &pattern,
+			const PostReadCallback &cb);
+
+	/**
+	 * Register a pre-write callback on all registers whose path matches a
+	 * pattern (see bindPreReadCallback())
+	 * @param pattern Path pattern
+	 * @param cb Callback
+	 * @return Binding ID
+	 */
+	::hv::common::hvcbID_t bindPreWriteCallback(const RegisterPattern &pattern,
+			const PreWriteCallback &cb);
+
+	/**
+	 * Register a post-write callback on all registers whose path matches a
+	 * pattern (see bindPreReadCallback())
+	 * @param pattern Path pattern
+	 * @param cb Callback
+	 * @return Binding ID
+	 */
+	::hv::common::hvcbID_t bindPostWriteCallback(const RegisterPattern &pattern,
+			const PostWriteCallback &cb);
+
+	/**
+	 * Remove a pattern binding: its callbacks are unregistered from bound
+	 * registers and it no longer applies to inserted registers
+	 * @param id Binding ID
+	 * @return true if binding was found, false else
+	 */
+	bool unbindCallbacks(const ::hv::common::hvcbID_t &id);
+
+	/**
+	 * Get number of registers a pattern binding is applied to
+	 * @param id Binding ID
+	 * @return Number of bound registers
+	 */
+	std::size_t howManyBoundRegisters(const ::hv::common::hvcbID_t &id) const;
+
 //** Children accessors and helpers **//
 	/**
 	 * Get register address from its name
@@ -335,6 +633,24 @@ public:
 	 */
 	Register& getRegister(const ::hv::common::hvaddr_t &address) const;
 
+	/**
+	 * Get pointer to register in current register file from its address (recursive)
+	 *
+	 * Unlike getRegister(), a missing register is not an error.
+	 * @param address Address of desired register
+	 * @return Pointer to desired register, nullptr if no register starts at address
+	 */
+	Register* tryGetRegister(const ::hv::common::hvaddr_t &address) const;
+
+	/**
+	 * Get pointer to register containing an address (recursive)
+	 * @param address Address
+	 * @param offset If not nullptr, set to offset of address in register
+	 * @return Pointer to register, nullptr if no register contains address
+	 */
+	Register* tryGetEnclosingRegister(const ::hv::common::hvaddr_t &address,
+			::hv::common::hvaddr_t *offset = nullptr) const;
+
 	/**
 	 * Get reference to register in current register file from its name
 	 *
@@ -361,6 +677,12 @@ public:
 	 */
 	RegisterFile& getRegisterFile(const std::string &name) const;
 
+	/**
+	 * Get map address/register listing all descending hierarchy
+	 * @return Const reference to flattened register map
+	 */
+	const rmap_t& getAllRegisters() const;
+
 //** Access operators overloading **//
 	/**
 	 * Operator () overloading -> equivalent to getRegister
@@ -392,8 +714,8 @@ public:
 
 //** Read/Write methods **//
 	/**
-	 * Read from register in register file
-	 * @param address Address of register
+	 * Read from register or region in register file
+	 * @param address Address of register or in region
 	 * @param readBuff Read buffer
 	 * @param readSize Read size
 	 */
@@ -401,14 +723,126 @@ public:
 			const std::size_t &readSize);
 
 	/**
-	 * Write to register in register file
-	 * @param address Address of register
+	 * Write to register or region in register file
+	 * @param address Address of register or in region
 	 * @param writeBuff Write buffer
 	 * @param writeSize Write size
 	 */
 	bool write(const ::hv::common::hvaddr_t &address, const ::hv::common::hvuint8_t* writeBuff,
 			const std::size_t &writeSize);
 
+//** Access statistics **//
+	/**
+	 * Enable access statistics
+	 *
+	 * Access counters are attached to all registers of the hierarchy, including
+	 * registers inserted later. They are stored in one block shared by
+	 * registers and register file: they can be destroyed in any order.
+	 * Registers keep counting in their counters after register file
+	 * destruction.
+	 * A register already counting for another register file (e.g. a child
+	 * register file or an alias) keeps its counters, which both files report.
+	 * Warns and does nothing when statistics are compiled out
+	 * (HV_REG_DISABLE_STATISTICS).
+	 */
+	void enableAccessStatistics();
+
+	/**
+	 * Disable access statistics and detach counters of this register file
+	 * from registers
+	 *
+	 * Counted registers must still exist.
+	 */
+	void disableAccessStatistics();
+
+	/**
+	 * Check if access statistics are enabled
+	 * @return true if enabled
+	 */
+	bool isAccessStatisticsEnabled() const;
+
+	/**
+	 * Reset all access counters of this register file to 0
+	 *
+	 * Counters shared with the register file which attached them are left
+	 * untouched.
+	 */
+	void resetAccessStatistics();
+
+	/**
+	 * Get access counters of a register
+	 * @param address Register address
+	 * @return Register access counters, nullptr if none are attached
+	 */
+	const RegisterAccessCounters* getAccessStatistics(
+			const ::hv::common::hvaddr_t &address) const;
+
+	/**
+	 * Get most accessed registers
+	 * @param n Maximum number of registers to return
+	 * @return Pairs address/counters sorted by decreasing number of accesses
+	 */
+	std::vector<std::pair<::hv::common::hvaddr_t, RegisterAccessCounters> > getHottestRegisters(
+			const std::size_t &n) const;
+
+	/**
+	 * Get a table of most accessed registers
+	 * @param n Maximum number of registers to display
+	 * @return Information string
+	 */
+	std::string getAccessStatisticsReport(const std::size_t &n = 20u) const;
+
+//** Access trace **//
+	/**
+	 * Record all register accesses of the hierarchy
+	 *
+	 * Recorder is attached to all registers of the hierarchy, including
+	 * registers inserted later, with their address relatively to this register
+	 * file. Register file does not own the recorder.
+	 * @param recorder Trace recorder, nullptr to stop recording
+	 */
+	void setTraceRecorder(AccessTraceRecorder *recorder);
+
+	/**
+	 * Get trace recorder
+	 * @return Trace recorder, nullptr if none
+	 */
+	AccessTraceRecorder* getTraceRecorder() const;
+
+//** Post-write coalescing **//
+	/**
+	 * Coalesce post-write notifications of all registers of the hierarchy
+	 *
+	 * Coalescer is attached to all registers of the hierarchy, including
+	 * registers inserted later. Register file does not own the coalescer.
+	 * @param coalescerIn Coalescer, nullptr to stop coalescing
+	 */
+	void setPostWriteCoalescer(PostWriteCoalescer *coalescerIn);
+
+	/**
+	 * Get post-write coalescer
+	 * @return Post-write coalescer, nullptr if none
+	 */
+	PostWriteCoalescer* getPostWriteCoalescer() const;
+
+//** Asynchronous callbacks **//
+	/**
+	 * Run asynchronous callbacks of all registers of the hierarchy on a worker
+	 * pool
+	 *
+	 * Pool is attached to all registers of the hierarchy, including registers
+	 * inserted later. Register file does not own the pool.
+	 * @param poolIn Worker pool, nullptr to run asynchronous callbacks
+	 * synchronously
+	 */
+	void setCallbackWorkerPool(CallbackWorkerPool *poolIn);
+
+	/**
+	 * Get callback worker pool
+	 * @return Worker pool, nullptr if none
+	 */
+	CallbackWorkerPool* getCallbackWorkerPool() const;
+
 	/**
 	 * Get information about all registers and register files contained by current register file.
 	 * @return Information string
@@ -483,6 +917,214 @@ protected:
 	 */
 	std::vector<RegisterFile*> regFilesToDelete;
 
+	/**
+	 * Access counters, one per counted register (shared with registers)
+	 */
+	std::shared_ptr<std::vector<RegisterAccessCounters> > accessCounters;
+
+	/**
+	 * Registers counted by accessCounters (same order)
+	 */
+	std::vector<Register*> countedRegisters;
+
+	/**
+	 * Access statistics activation
+	 */
+	bool accessStatisticsEnabled;
+
+	/**
+	 * Attach new access counters to register, unless it already has some
+	 * @param reg Register to count accesses of
+	 */
+	void attachAccessCounters(Register &reg);
+
+	/**
+	 * Trace recorder attached to registers (nullptr if none)
+	 */
+	AccessTraceRecorder *traceRecorder;
+
+	/**
+	 * Post-write coalescer attached to registers (nullptr if none)
+	 */
+	PostWriteCoalescer *coalescer;
+
+	/**
+	 * Worker pool attached to registers (nullptr if none)
+	 */
+	CallbackWorkerPool *workerPool;
+
+	/**
+	 * Size in bytes of largest register, register file, banked window and
+	 * region inserted (bound the search of elements recovering a block in
+	 * isSpaceFree(), one per map)
+	 */
+	std::size_t maxRegisterSize;
+	std::size_t maxRegisterFileSize;
+	std::size_t maxWindowSize;
+	std::size_t maxRegionSize;
+
+	/**
+	 * Layout revision
+	 */
+	::hv::common::hvuint64_t revision;
+
+	/**
+	 * Register files decoding current register file (itself, and register
+	 * files it is inserted in, directly or as a bank). Shared with them so
+	 * that they can leave it on destruction.
+	 */
+	std::shared_ptr<std::vector<RegisterFile*> > decoders;
+
+	/**
+	 * Decoder lists of register files of descending hierarchy and banks
+	 */
+	std::vector<std::shared_ptr<std::vector<RegisterFile*> > > hierarchyDecoders;
+
+	/**
+	 * Add current register file as decoder of an inserted register file and
+	 * its hierarchy
+	 * @param regFile Inserted register file or bank
+	 */
+	void decodeHierarchy(RegisterFile &regFile);
+
+	/**
+	 * Increment revision of all register files decoding current one
+	 */
+	void incrementDecodersRevision();
+
+	/**
+	 * Banked window
+	 */
+	struct BankedWindow {
+		/**
+		 * Window size in bytes
+		 */
+		std::size_t size;
+
+		std::vector<RegisterFile*> banks;
+
+		std::size_t active;
+
+		/**
+		 * Register files decoding this window (revisions incremented on bank switch)
+		 */
+		std::vector<RegisterFile*> owners;
+
+		/**
+		 * Selector register (nullptr if none) and ID of its bank selection hook
+		 */
+		Register *selector;
+		::hv::common::hvcbID_t selectorHookId;
+	};
+
+	typedef std::map<::hv::common::hvaddr_t, std::shared_ptr<BankedWindow> > wmap_t;
+
+	/**
+	 * Map address/banked windows created in current register file
+	 */
+	wmap_t bankedWindows;
+
+	/**
+	 * Map address/banked windows listing all descending hierarchy
+	 */
+	wmap_t allBankedWindows;
+
+	/**
+	 * Access rule of an address range
+	 */
+	struct AccessRule {
+		::hv::common::hvaddr_t start;
+		::hv::common::hvaddr_t end;
+		AccessPermission permission;
+	};
+
+	/**
+	 * Access rules, in order of definition
+	 */
+	std::vector<AccessRule> accessRules;
+
+	/**
+	 * Address-range callbacks
+	 */
+	RangeCallbackMap rangeCallbacks;
+
+	/**
+	 * Index path/address of all registers of allRegisters
+	 */
+	std::multimap<std::string, ::hv::common::hvaddr_t> registerPaths;
+
+	/**
+	 * Callback bound to registers matching a pattern
+	 */
+	struct PatternBinding {
+		RegisterPattern pattern;
+
+		/**
+		 * Registers callback on a register, returns its ID
+		 */
+		std::function<::hv::common::hvcbID_t(Register&)> attach;
+
+		/**
+		 * Unregisters callback from a register
+		 */
+		std::function<bool(Register&, const ::hv::common::hvcbID_t&)> detach;
+
+		/**
+		 * Bound registers and their callback IDs
+		 */
+		std::vector<std::pair<Register*, ::hv::common::hvcbID_t> > bound;
+	};
+
+	/**
+	 * Pattern bindings by ID
+	 */
+	std::map<::hv::common::hvcbID_t, PatternBinding> patternBindings;
+
+	::hv::common::hvcbID_t nextBindingId;
+
+	/**
+	 * Index a register inserted in allRegisters and apply matching bindings
+	 * @param path Register path
+	 * @param address Register address
+	 * @param reg Register
+	 */
+	void indexRegister(const std::string &path,
+			const ::hv::common::hvaddr_t &address, Register &reg);
+
+	/**
+	 * Add a pattern binding and apply it to matching registers
+	 * @param binding Binding (without bound registers)
+	 * @return Binding ID
+	 */
+	::hv::common::hvcbID_t bindCallbacks(const PatternBinding &binding);
+
+	/**
+	 * Switch active bank of a window
+	 * @param window Banked window
+	 * @param bank Bank number
+	 * @return true if success, false if there is no such bank
+	 */
+	static bool switchBank(BankedWindow &window,
+			const ::hv::common::hvuint64_t &bank);
+
+	/**
+	 * Find window of all descending hierarchy containing an address
+	 * @param address Address
+	 * @return Iterator to window, allBankedWindows.cend() if none
+	 */
+	wmap_t::const_iterator findBankedWindow(
+			const ::hv::common::hvaddr_t &address) const;
+
+	/**
+	 * Map address/regions inserted in current register file
+	 */
+	armap_t regions;
+
+	/**
+	 * Map address/regions listing all descending hierarchy
+	 */
+	armap_t allRegions;
+
 private:
 	/**
 	 * If fixedSize == 0, then this registerFile has no defined size.
@@ -0,0 +1,124 @@
+/**
+ * @file registerfile_generator.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Synthetic register map generator
+ */
+
+#include "registerfile_generator.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+RegisterMapGenerator::RegisterMapGenerator(
+		const RegisterMapGeneratorConfig &configIn) :
+		config(configIn), fieldCount(0u), callbackRegisterCount(0u), widthInd(
+				0u), rng(configIn.seed) {
+	if (config.registerWidths.empty()) {
+		HV_ERR("At least one register width must be specified")
+		exit(EXIT_FAILURE);
+	}
+}
+
+RegisterMapGenerator::~RegisterMapGenerator() {
+}
+
+RegisterFile& RegisterMapGenerator::generate() {
+	registerFiles.clear();
+	fieldCount = 0u;
+	callbackRegisterCount = 0u;
+	widthInd = 0u;
+	rng.seed(config.seed);
+	registerFiles.reserve(config.getRegisterFileCount());
+	return this->build(0u, "RF");
+}
+
+const RegisterMapGeneratorConfig& RegisterMapGenerator::getConfig() const {
+	return config;
+}
+
+RegisterFile& RegisterMapGenerator::getRoot() const {
+	if (registerFiles.empty()) {
+		HV_ERR("No register map generated")
+		exit(EXIT_FAILURE);
+	}
+	return *registerFiles.front();
+}
+
+std::vector<hvaddr_t> RegisterMapGenerator::getAddresses() const {
+	std::vector<hvaddr_t> ret;
+	const RegisterFile::rmap_t &regs = this->getRoot().getAllRegisters();
+	ret.reserve(regs.size());
+	for (RegisterFile::rmap_t::const_iterator it = regs.cbegin();
+			it != regs.cend(); ++it) {
+		ret.push_back(it->first);
+	}
+	return ret;
+}
+
+std::size_t RegisterMapGenerator::getFieldCount() const {
+	return fieldCount;
+}
+
+std::size_t RegisterMapGenerator::getCallbackRegisterCount() const {
+	return callbackRegisterCount;
+}
+
+RegisterFile& RegisterMapGenerator::build(const std::size_t &level,
+		const std::string &path) {
+	registerFiles.emplace_back(
+			new RegisterFile(path, "Generated register file",
+					config.alignment));
+	RegisterFile &rf = *registerFiles.back();
+	std::bernoulli_distribution hasFields(config.fieldDensity);
+	std::bernoulli_distribution hasCallbacks(config.callbackDensity);
+
+	// Registers
+	hvaddr_t addr(0u);
+	for (std::size_t i = 0; i < config.registersPerFile; i++) {
+		const std::size_t width = config.registerWidths[widthInd++
+				% config.registerWidths.size()];
+		const std::size_t widthInBytes = HV_BIT_TO_BYTE(width);
+		addr = rf.getNearestSuperiorAlignedAddress(addr,
+				config.alignment ? config.alignment : widthInBytes);
+		if (!rf.createRegister(addr, width, path + "_R" + std::to_string(i), "",
+				RW, 0u)) {
+			HV_ERR("Generated register insertion failed")
+			exit(EXIT_FAILURE);
+		}
+		Register &reg = rf.getRegister(addr);
+		if (hasFields(rng)) {
+			for (std::size_t b = 0; b + 8u <= width; b += 8u) {
+				reg.createField("F" + std::to_string(b / 8u), b + 7u, b);
+				fieldCount++;
+			}
+		}
+		if (hasCallbacks(rng)) {
+			reg.registerPreReadCallback(
+					[](const RegisterReadEvent&) {return true;});
+			reg.registerPostWriteCallback([](const RegisterWriteEvent&) {});
+			callbackRegisterCount++;
+		}
+		addr += widthInBytes;
+	}
+
+	// Sub-register files
+	if (level < config.depth) {
+		for (std::size_t i = 0; i < config.fanOut; i++) {
+			RegisterFile &child = this->build(level + 1u,
+					path + "_" + std::to_string(i));
+			if (!rf.addRegisterFile(child)) {
+				HV_ERR("Generated register file insertion failed")
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+	return rf;
+}
+
+} // namespace reg
+} // namespace hv
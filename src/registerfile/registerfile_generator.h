@@ -0,0 +1,201 @@
+/**
+ * @file registerfile_generator.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Synthetic register map generator
+ */
+
+#ifndef HV_REGISTERFILE_GENERATOR_H_
+#define HV_REGISTERFILE_GENERATOR_H_
+
+#include <memory>
+#include <random>
+#include <vector>
+#include <hv/common.h>
+
+#include "registerfile.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * Synthetic register map parameters
+ */
+struct RegisterMapGeneratorConfig {
+
+	RegisterMapGeneratorConfig() :
+			depth(0u), fanOut(1u), registersPerFile(16u), registerWidths(1u,
+					32u), alignment(4u), fieldDensity(0.0), callbackDensity(
+					0.0), seed(0u) {
+	}
+
+	/**
+	 * Get number of registers in generated map
+	 * @return Number of registers
+	 */
+	std::size_t getRegisterCount() const {
+		return registersPerFile * getRegisterFileCount();
+	}
+
+	/**
+	 * Get number of register files in generated map (including root)
+	 * @return Number of register files
+	 */
+	std::size_t getRegisterFileCount() const {
+		std::size_t ret(1u), levelCount(1u);
+		for (std::size_t i = 0; i < depth; i++) {
+			levelCount *= fanOut;
+			ret += levelCount;
+		}
+		return ret;
+	}
+
+	/**
+	 * Number of register file levels below root (0 for a flat map)
+	 */
+	std::size_t depth;
+
+	/**
+	 * Number of sub-register files per register file
+	 */
+	std::size_t fanOut;
+
+	/**
+	 * Number of registers per register file
+	 */
+	std::size_t registersPerFile;
+
+	/**
+	 * Register widths in bits, used in turn
+	 */
+	std::vector<std::size_t> registerWidths;
+
+	/**
+	 * Alignment of all register files in bytes
+	 */
+	std::size_t alignment;
+
+	/**
+	 * Proportion of registers split into 8-bit fields (0.0 to 1.0)
+	 */
+	double fieldDensity;
+
+	/**
+	 * Proportion of registers having pre-read and post-write callbacks (0.0 to 1.0)
+	 */
+	double callbackDensity;
+
+	/**
+	 * Random generator seed: a given configuration always generates the same map
+	 */
+	::hv::common::hvuint32_t seed;
+};
+
+/**
+ * RegisterMapGenerator class
+ *
+ * Procedurally builds large RegisterFile hierarchies for scaling tests and
+ * benchmarks. Each register file holds registersPerFile registers followed by
+ * fanOut sub-register files. The generator owns all created register files.
+ */
+class RegisterMapGenerator {
+public:
+//** Constructors **//
+	/**
+	 * RegisterMapGenerator constructor
+	 * @param configIn Map parameters
+	 */
+	RegisterMapGenerator(const RegisterMapGeneratorConfig &configIn);
+
+	RegisterMapGenerator(const RegisterMapGenerator &) = delete;
+	RegisterMapGenerator& operator=(const RegisterMapGenerator &) = delete;
+
+//** Destructor **//
+	virtual ~RegisterMapGenerator();
+
+//** Generation **//
+	/**
+	 * Generate register map
+	 *
+	 * A previously generated map is destroyed.
+	 * @return Root register file
+	 */
+	RegisterFile& generate();
+
+//** Accessors **//
+	/**
+	 * Get map parameters
+	 * @return Map parameters
+	 */
+	const RegisterMapGeneratorConfig& getConfig() const;
+
+	/**
+	 * Get root register file of generated map
+	 * @return Root register file
+	 */
+	RegisterFile& getRoot() const;
+
+	/**
+	 * Get addresses of all generated registers, relatively to root
+	 * @return Register addresses in increasing order
+	 */
+	std::vector<::hv::common::hvaddr_t> getAddresses() const;
+
+	/**
+	 * Get number of generated fields
+	 * @return Number of fields
+	 */
+	std::size_t getFieldCount() const;
+
+	/**
+	 * Get number of registers with callbacks
+	 * @return Number of registers with callbacks
+	 */
+	std::size_t getCallbackRegisterCount() const;
+
+protected:
+	/**
+	 * Build one register file and its sub-register files
+	 * @param level Level of register file (0 for root)
+	 * @param path Register file path, used to name elements
+	 * @return Built register file
+	 */
+	RegisterFile& build(const std::size_t &level, const std::string &path);
+
+	/**
+	 * Map parameters
+	 */
+	RegisterMapGeneratorConfig config;
+
+	/**
+	 * Generated register files (root first)
+	 */
+	std::vector<std::unique_ptr<RegisterFile> > registerFiles;
+
+	/**
+	 * Number of generated fields
+	 */
+	std::size_t fieldCount;
+
+	/**
+	 * Number of registers with callbacks
+	 */
+	std::size_t callbackRegisterCount;
+
+	/**
+	 * Index of next register width
+	 */
+	std::size_t widthInd;
+
+	/**
+	 * Random generator for field and callback placement
+	 */
+	std::mt19937 rng;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTERFILE_GENERATOR_H_ */
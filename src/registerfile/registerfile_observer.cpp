@@ -0,0 +1,164 @@
+/**
+ * @file registerfile_observer.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Read-only lock-free observer view of a RegisterFile
+ */
+
+#include "registerfile_observer.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+RegisterFileObserver::RegisterFileObserver(const RegisterFile &regFileIn) :
+		front(0u), epochCpt(0u) {
+	const RegisterFile::rmap_t &regs = regFileIn.getAllRegisters();
+	std::size_t offset(0u);
+	entries.reserve(regs.size());
+	sources.reserve(regs.size());
+	for (RegisterFile::rmap_t::const_iterator it = regs.cbegin();
+			it != regs.cend(); ++it) {
+		Entry entry;
+		entry.address = it->first;
+		entry.name = it->second.getName();
+		entry.offset = offset;
+		entry.sizeInBytes = it->second.getSizeInBytes();
+		index[entry.address] = entries.size();
+		entries.push_back(entry);
+		sources.push_back(&it->second);
+		offset += entry.sizeInBytes;
+	}
+	// Initial publication: both buffers hold current values
+	shadow.resize(offset);
+	for (std::size_t i = 0; i < entries.size(); i++) {
+		sources[i]->debugRead(shadow.data() + entries[i].offset,
+				entries[i].sizeInBytes);
+	}
+	for (unsigned int i = 0; i < 2u; i++) {
+		buffers[i].sequence.store(0u, std::memory_order_relaxed);
+		buffers[i].epoch.store(0u, std::memory_order_relaxed);
+		buffers[i].image = shadow;
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+RegisterFileObserver::~RegisterFileObserver() {
+}
+
+std::size_t RegisterFileObserver::publish() {
+	// Detecting modified registers
+	// Registers can be modified through many paths (bus accesses, model code,
+	// field handles) so values are compared against last published ones
+	dirty.clear();
+	for (std::size_t i = 0; i < entries.size(); i++) {
+		hvuint8_t *shadowPtr = shadow.data() + entries[i].offset;
+		const void *value = this->valueOf(i);
+		if (std::memcmp(shadowPtr, value, entries[i].sizeInBytes)) {
+			std::memcpy(shadowPtr, value, entries[i].sizeInBytes);
+			dirty.push_back(i);
+		}
+	}
+	if (dirty.empty()) {
+		return 0u;
+	}
+
+	unsigned int back = 1u - front.load(std::memory_order_relaxed);
+	Buffer &buffer = buffers[back];
+	hvuint64_t seq = buffer.sequence.load(std::memory_order_relaxed);
+	buffer.sequence.store(seq + 1u, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	// Back buffer holds the values of the publication before last:
+	// it misses registers published last time and registers published now
+	for (std::vector<std::size_t>::const_iterator it = lastDirty.cbegin();
+			it != lastDirty.cend(); ++it) {
+		std::memcpy(buffer.image.data() + entries[*it].offset,
+				shadow.data() + entries[*it].offset, entries[*it].sizeInBytes);
+	}
+	for (std::vector<std::size_t>::const_iterator it = dirty.cbegin();
+			it != dirty.cend(); ++it) {
+		std::memcpy(buffer.image.data() + entries[*it].offset,
+				shadow.data() + entries[*it].offset, entries[*it].sizeInBytes);
+	}
+	hvuint64_t epoch = epochCpt.load(std::memory_order_relaxed) + 1u;
+	buffer.epoch.store(epoch, std::memory_order_relaxed);
+	buffer.sequence.store(seq + 2u, std::memory_order_release);
+	front.store(back, std::memory_order_release);
+	epochCpt.store(epoch, std::memory_order_release);
+
+	lastDirty.swap(dirty);
+	return lastDirty.size();
+}
+
+hvuint64_t RegisterFileObserver::getEpoch() const {
+	return epochCpt.load(std::memory_order_acquire);
+}
+
+std::size_t RegisterFileObserver::getRegisterCount() const {
+	return entries.size();
+}
+
+const std::vector<RegisterFileObserver::Entry>& RegisterFileObserver::getEntries() const {
+	return entries;
+}
+
+std::size_t RegisterFileObserver::getImageSize() const {
+	return shadow.size();
+}
+
+bool RegisterFileObserver::read(const hvaddr_t &address, hvuint8_t* readBuff,
+		const std::size_t &readSize, hvuint64_t* epoch) const {
+	std::unordered_map<hvaddr_t, std::size_t>::const_iterator it = index.find(
+			address);
+	if (it == index.cend()) {
+		HV_WARN(
+				"No observed register @" << std::hex << std::uppercase << "0x" << address)
+		return false;
+	}
+	const Entry &entry = entries[it->second];
+	hvuint64_t epochTmp = copyFromFront(entry.offset,
+			HV_MIN(readSize, entry.sizeInBytes), readBuff);
+	if (epoch != nullptr) {
+		*epoch = epochTmp;
+	}
+	return true;
+}
+
+hvuint64_t RegisterFileObserver::snapshot(std::vector<hvuint8_t> &image) const {
+	image.resize(shadow.size());
+	return copyFromFront(0u, image.size(), image.data());
+}
+
+const void* RegisterFileObserver::valueOf(const std::size_t &ind) {
+	if (!sources[ind]->isValueProvided()) {
+		return sources[ind]->getDataAddress();
+	}
+	scratch.resize(entries[ind].sizeInBytes);
+	sources[ind]->debugRead(scratch.data(), scratch.size());
+	return scratch.data();
+}
+
+hvuint64_t RegisterFileObserver::copyFromFront(const std::size_t &offset,
+		const std::size_t &size, hvuint8_t* dest) const {
+	for (;;) {
+		const Buffer &buffer = buffers[front.load(std::memory_order_acquire)];
+		hvuint64_t seq1 = buffer.sequence.load(std::memory_order_acquire);
+		if (seq1 & 1u) {
+			// Writer wrapped around and is updating this buffer
+			continue;
+		}
+		std::memcpy(dest, buffer.image.data() + offset, size);
+		hvuint64_t epoch = buffer.epoch.load(std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		hvuint64_t seq2 = buffer.sequence.load(std::memory_order_relaxed);
+		if (seq1 == seq2) {
+			return epoch;
+		}
+	}
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,231 @@
+/**
+ * @file registerfile_observer.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Read-only lock-free observer view of a RegisterFile
+ */
+
+#ifndef HV_REGISTERFILE_OBSERVER_H_
+#define HV_REGISTERFILE_OBSERVER_H_
+
+#include <atomic>
+#include <vector>
+#include <unordered_map>
+#include <hv/common.h>
+
+#include "registerfile.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * RegisterFileObserver class
+ *
+ * Publishes register values of a RegisterFile hierarchy to monitoring threads
+ * (GUIs, debuggers, loggers) without ever taking a lock on the simulation side.
+ *
+ * The simulation thread calls publish() at points of its choice (e.g. at the
+ * end of a quantum). Only registers whose value changed since the previous
+ * publication are copied. Values are published in one of two image buffers,
+ * each protected by its own sequence counter; the front buffer index is then
+ * swapped. Readers never block the simulation: they copy from the front buffer
+ * and retry only if the writer recycled that buffer during their copy.
+ *
+ * The observed layout is the one of the register file at observer construction.
+ */
+class RegisterFileObserver {
+public:
+//** Type definitions **//
+	/**
+	 * Layout entry of an observed register
+	 */
+	struct Entry {
+		/**
+		 * Register address relatively to observed register file
+		 */
+		::hv::common::hvaddr_t address;
+
+		/**
+		 * Register name
+		 */
+		std::string name;
+
+		/**
+		 * Offset of register value in published images
+		 */
+		std::size_t offset;
+
+		/**
+		 * Register size in bytes
+		 */
+		std::size_t sizeInBytes;
+	};
+
+//** Constructors **//
+	/**
+	 * RegisterFileObserver constructor
+	 * @param regFileIn Register file to observe
+	 */
+	RegisterFileObserver(const RegisterFile &regFileIn);
+
+	RegisterFileObserver(const RegisterFileObserver &) = delete;
+	RegisterFileObserver& operator=(const RegisterFileObserver &) = delete;
+
+//** Destructor **//
+	virtual ~RegisterFileObserver();
+
+//** Simulation side **//
+	/**
+	 * Publish register values modified since last publication
+	 *
+	 * Must be called from the thread owning the register file.
+	 * @return Number of registers published
+	 */
+	std::size_t publish();
+
+//** Observer side (thread-safe) **//
+	/**
+	 * Get publication epoch
+	 *
+	 * Epoch is incremented each time publish() actually publishes something.
+	 * @return Current epoch
+	 */
+	::hv::common::hvuint64_t getEpoch() const;
+
+	/**
+	 * Get number of observed registers
+	 * @return Number of observed registers
+	 */
+	std::size_t getRegisterCount() const;
+
+	/**
+	 * Get observed layout (immutable after construction)
+	 * @return Layout entries sorted by address
+	 */
+	const std::vector<Entry>& getEntries() const;
+
+	/**
+	 * Get size of a full value image in bytes
+	 * @return Image size in bytes
+	 */
+	std::size_t getImageSize() const;
+
+	/**
+	 * Read last published value of a register
+	 * @param address Register address
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes (at most register size in bytes)
+	 * @param epoch If not nullptr, receives the epoch of the value read
+	 * @return true if success, false if no register is observed at address
+	 */
+	bool read(const ::hv::common::hvaddr_t &address,
+			::hv::common::hvuint8_t* readBuff, const std::size_t &readSize,
+			::hv::common::hvuint64_t* epoch = nullptr) const;
+
+	/**
+	 * Copy a consistent image of all published register values
+	 *
+	 * Register values are laid out as described by getEntries().
+	 * @param image Destination image, resized to getImageSize()
+	 * @return Epoch of the copied image
+	 */
+	::hv::common::hvuint64_t snapshot(
+			std::vector<::hv::common::hvuint8_t> &image) const;
+
+protected:
+	/**
+	 * Published value image
+	 */
+	struct Buffer {
+		/**
+		 * Sequence counter (odd while the buffer is being updated)
+		 */
+		std::atomic<::hv::common::hvuint64_t> sequence;
+
+		/**
+		 * Epoch of published values
+		 */
+		std::atomic<::hv::common::hvuint64_t> epoch;
+
+		/**
+		 * Register values
+		 */
+		std::vector<::hv::common::hvuint8_t> image;
+	};
+
+	/**
+	 * Copy bytes from front buffer in a consistent way
+	 * @param offset Offset in image
+	 * @param size Number of bytes to copy
+	 * @param dest Destination
+	 * @return Epoch of copied bytes
+	 */
+	::hv::common::hvuint64_t copyFromFront(const std::size_t &offset,
+			const std::size_t &size, ::hv::common::hvuint8_t* dest) const;
+
+	/**
+	 * Get current value of an observed register
+	 *
+	 * Values computed on demand are evaluated in scratch buffer.
+	 * @param ind Register index
+	 * @return Address of register value, valid until next call
+	 */
+	const void* valueOf(const std::size_t &ind);
+
+	/**
+	 * Observed registers layout
+	 */
+	std::vector<Entry> entries;
+
+	/**
+	 * Observed registers (same order as entries)
+	 */
+	std::vector<const Register*> sources;
+
+	/**
+	 * Map address/entry index
+	 */
+	std::unordered_map<::hv::common::hvaddr_t, std::size_t> index;
+
+	/**
+	 * Simulation-side copy of last published values
+	 */
+	std::vector<::hv::common::hvuint8_t> shadow;
+
+	/**
+	 * Evaluation buffer of values computed on demand
+	 */
+	std::vector<::hv::common::hvuint8_t> scratch;
+
+	/**
+	 * Registers published during last publication
+	 */
+	std::vector<std::size_t> lastDirty;
+
+	/**
+	 * Registers being published
+	 */
+	std::vector<std::size_t> dirty;
+
+	/**
+	 * Double buffer
+	 */
+	Buffer buffers[2];
+
+	/**
+	 * Index of buffer readers have to use
+	 */
+	std::atomic<unsigned int> front;
+
+	/**
+	 * Publication counter
+	 */
+	std::atomic<::hv::common::hvuint64_t> epochCpt;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTERFILE_OBSERVER_H_ */
@@ -0,0 +1,456 @@
+/**
+ * @file registerfile_shared_memory.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Shared-memory export of RegisterFile values
+ */
+
+#include <cerrno>
+#include <thread>
+
+#include "registerfile_shared_memory.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HV_REG_HAS_SHARED_MEMORY
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+static_assert(sizeof(std::atomic<hvuint64_t>) == sizeof(hvuint64_t),
+		"Shared-memory sequence counter must be a plain 64-bit word");
+
+namespace {
+
+const char shmMagic[8] = { 'H', 'V', 'R', 'E', 'G', 'S', 'H', 'M' };
+
+std::size_t alignTo8(const std::size_t &val) {
+	return (val + 7u) & ~std::size_t(7u);
+}
+
+std::atomic<hvuint64_t>& sequenceOf(SharedMemoryHeader *header) {
+	return *reinterpret_cast<std::atomic<hvuint64_t>*>(&header->sequence);
+}
+
+const std::atomic<hvuint64_t>& sequenceOf(const SharedMemoryHeader *header) {
+	return *reinterpret_cast<const std::atomic<hvuint64_t>*>(&header->sequence);
+}
+
+/**
+ * Check that a block of size bytes at base + offset lies in a segment of
+ * segmentSize bytes, without overflowing
+ */
+bool fitsInSegment(const hvuint64_t &base, const hvuint64_t &offset,
+		const hvuint64_t &size, const std::size_t &segmentSize) {
+	return (base <= segmentSize) && (offset <= segmentSize - base)
+			&& (size <= segmentSize - base - offset);
+}
+
+} // namespace
+
+const hvuint32_t RegisterFileSharedMemory::version;
+const unsigned int RegisterFileSharedMemoryReader::maxReadAttempts;
+
+RegisterFileSharedMemory::RegisterFileSharedMemory(const RegisterFile &regFileIn) :
+		regFile(regFileIn), segment(nullptr), segmentSize(0u), segmentDevice(
+				0u), segmentInode(0u) {
+}
+
+RegisterFileSharedMemory::~RegisterFileSharedMemory() {
+	this->close();
+}
+
+bool RegisterFileSharedMemory::open(const std::string &segmentNameIn,
+		const bool &replace) {
+#ifdef HV_REG_HAS_SHARED_MEMORY
+	if (this->isOpen()) {
+		HV_WARN("Shared-memory segment " << segmentName << " is already open")
+		return false;
+	}
+	const RegisterFile::rmap_t &regs = regFile.getAllRegisters();
+
+	// Computing layout
+	std::size_t stringsSize(0u);
+	std::size_t valuesSize(0u);
+	for (RegisterFile::rmap_t::const_iterator it = regs.cbegin();
+			it != regs.cend(); ++it) {
+		stringsSize += it->second.getName().size() + 1u;
+		valuesSize += it->second.getSizeInBytes();
+	}
+	std::size_t entriesOffset = alignTo8(sizeof(SharedMemoryHeader));
+	std::size_t stringsOffset = entriesOffset
+			+ regs.size() * sizeof(SharedMemoryEntry);
+	std::size_t valuesOffset = alignTo8(stringsOffset + stringsSize);
+	std::size_t size = alignTo8(valuesOffset + valuesSize);
+
+	// Creating and mapping segment, a live segment is never truncated
+	if (replace) {
+		shm_unlink(segmentNameIn.c_str());
+	}
+	int fd = shm_open(segmentNameIn.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+	if (fd < 0) {
+		if (errno == EEXIST) {
+			HV_WARN(
+					"Shared-memory segment " << segmentNameIn << " already exists")
+		} else {
+			HV_WARN("Could not create shared-memory segment " << segmentNameIn)
+		}
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) || ftruncate(fd, static_cast<off_t>(size))) {
+		HV_WARN("Could not size shared-memory segment " << segmentNameIn)
+		::close(fd);
+		shm_unlink(segmentNameIn.c_str());
+		return false;
+	}
+	void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	::close(fd);
+	if (addr == MAP_FAILED) {
+		HV_WARN("Could not map shared-memory segment " << segmentNameIn)
+		shm_unlink(segmentNameIn.c_str());
+		return false;
+	}
+	segment = static_cast<hvuint8_t*>(addr);
+	segmentSize = size;
+	segmentName = segmentNameIn;
+	segmentDevice = static_cast<hvuint64_t>(st.st_dev);
+	segmentInode = static_cast<hvuint64_t>(st.st_ino);
+	std::memset(segment, 0, size);
+
+	// Filling header, entries, names and values
+	SharedMemoryHeader *header = reinterpret_cast<SharedMemoryHeader*>(segment);
+	SharedMemoryEntry *entries = reinterpret_cast<SharedMemoryEntry*>(segment
+			+ entriesOffset);
+	std::memcpy(header->magic, shmMagic, sizeof(shmMagic));
+	header->version = version;
+	header->headerSize = sizeof(SharedMemoryHeader);
+	header->registerCount = static_cast<hvuint32_t>(regs.size());
+	header->entrySize = sizeof(SharedMemoryEntry);
+	header->entriesOffset = entriesOffset;
+	header->stringsOffset = stringsOffset;
+	header->valuesOffset = valuesOffset;
+	header->valuesSize = valuesSize;
+	header->segmentSize = size;
+
+	sources.clear();
+	offsets.clear();
+	index.clear();
+	registerIndex.clear();
+	std::size_t stringPos(0u);
+	std::size_t valuePos(0u);
+	for (RegisterFile::rmap_t::const_iterator it = regs.cbegin();
+			it != regs.cend(); ++it) {
+		std::string regName = it->second.getName();
+		SharedMemoryEntry &entry = entries[sources.size()];
+		entry.address = it->first;
+		entry.valueOffset = valuePos;
+		entry.sizeInBits = static_cast<hvuint32_t>(it->second.getSize());
+		entry.nameOffset = static_cast<hvuint32_t>(stringPos);
+		entry.nameLength = static_cast<hvuint32_t>(regName.size());
+		std::memcpy(segment + stringsOffset + stringPos, regName.c_str(),
+				regName.size());
+		it->second.debugRead(segment + valuesOffset + valuePos,
+				it->second.getSizeInBytes());
+		index[it->first] = sources.size();
+		registerIndex[&it->second] = sources.size();
+		sources.push_back(&it->second);
+		offsets.push_back(valuesOffset + valuePos);
+		stringPos += regName.size() + 1u;
+		valuePos += it->second.getSizeInBytes();
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+	return true;
+#else
+	HV_WARN("Shared-memory export is not supported on this platform")
+	return false;
+#endif
+}
+
+void RegisterFileSharedMemory::close() {
+#ifdef HV_REG_HAS_SHARED_MEMORY
+	if (this->isOpen()) {
+		munmap(segment, segmentSize);
+		// Name may have been taken over by a replacing segment
+		int fd = shm_open(segmentName.c_str(), O_RDONLY, 0);
+		if (fd >= 0) {
+			struct stat st;
+			if (!fstat(fd, &st)
+					&& (static_cast<hvuint64_t>(st.st_dev) == segmentDevice)
+					&& (static_cast<hvuint64_t>(st.st_ino) == segmentInode)) {
+				shm_unlink(segmentName.c_str());
+			}
+			::close(fd);
+		}
+	}
+#endif
+	segment = nullptr;
+	segmentSize = 0u;
+	segmentDevice = 0u;
+	segmentInode = 0u;
+	segmentName.clear();
+	sources.clear();
+	offsets.clear();
+	index.clear();
+	registerIndex.clear();
+}
+
+bool RegisterFileSharedMemory::isOpen() const {
+	return segment != nullptr;
+}
+
+std::string RegisterFileSharedMemory::getSegmentName() const {
+	return segmentName;
+}
+
+std::size_t RegisterFileSharedMemory::getSegmentSize() const {
+	return segmentSize;
+}
+
+std::size_t RegisterFileSharedMemory::publish() {
+	if (!this->isOpen()) {
+		return 0u;
+	}
+	std::size_t ret(0u);
+	bool updating(false);
+	for (std::size_t i = 0; i < sources.size(); i++) {
+		const void *value = this->valueOf(i);
+		if (std::memcmp(segment + offsets[i], value,
+				sources[i]->getSizeInBytes())) {
+			if (!updating) {
+				this->beginUpdate();
+				updating = true;
+			}
+			this->update(i, value);
+			ret++;
+		}
+	}
+	if (updating) {
+		this->endUpdate();
+	}
+	return ret;
+}
+
+bool RegisterFileSharedMemory::publish(const hvaddr_t &address) {
+	if (!this->isOpen()) {
+		return false;
+	}
+	std::unordered_map<hvaddr_t, std::size_t>::const_iterator it = index.find(
+			address);
+	if (it == index.cend()) {
+		return false;
+	}
+	return this->publishEntry(it->second);
+}
+
+bool RegisterFileSharedMemory::publish(const Register &reg) {
+	if (!this->isOpen()) {
+		return false;
+	}
+	std::unordered_map<const Register*, std::size_t>::const_iterator it =
+			registerIndex.find(&reg);
+	if (it == registerIndex.cend()) {
+		return false;
+	}
+	return this->publishEntry(it->second);
+}
+
+bool RegisterFileSharedMemory::publishEntry(const std::size_t &ind) {
+	const void *value = this->valueOf(ind);
+	if (!std::memcmp(segment + offsets[ind], value,
+			sources[ind]->getSizeInBytes())) {
+		return false;
+	}
+	this->beginUpdate();
+	this->update(ind, value);
+	this->endUpdate();
+	return true;
+}
+
+void RegisterFileSharedMemory::beginUpdate() {
+	SharedMemoryHeader *header = reinterpret_cast<SharedMemoryHeader*>(segment);
+	std::atomic<hvuint64_t> &seq = sequenceOf(header);
+	seq.store(seq.load(std::memory_order_relaxed) + 1u,
+			std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void RegisterFileSharedMemory::endUpdate() {
+	SharedMemoryHeader *header = reinterpret_cast<SharedMemoryHeader*>(segment);
+	header->epoch++;
+	std::atomic<hvuint64_t> &seq = sequenceOf(header);
+	seq.store(seq.load(std::memory_order_relaxed) + 1u,
+			std::memory_order_release);
+}
+
+void RegisterFileSharedMemory::update(const std::size_t &ind,
+		const void *value) {
+	std::memcpy(segment + offsets[ind], value, sources[ind]->getSizeInBytes());
+}
+
+const void* RegisterFileSharedMemory::valueOf(const std::size_t &ind) {
+	if (!sources[ind]->isValueProvided()) {
+		return sources[ind]->getDataAddress();
+	}
+	scratch.resize(sources[ind]->getSizeInBytes());
+	sources[ind]->debugRead(scratch.data(), scratch.size());
+	return scratch.data();
+}
+
+RegisterFileSharedMemoryReader::RegisterFileSharedMemoryReader() :
+		segment(nullptr), segmentSize(0u) {
+}
+
+RegisterFileSharedMemoryReader::~RegisterFileSharedMemoryReader() {
+	this->close();
+}
+
+bool RegisterFileSharedMemoryReader::open(const std::string &segmentName) {
+#ifdef HV_REG_HAS_SHARED_MEMORY
+	this->close();
+	int fd = shm_open(segmentName.c_str(), O_RDONLY, 0);
+	if (fd < 0) {
+		HV_WARN("Could not open shared-memory segment " << segmentName)
+		return false;
+	}
+	struct stat st;
+	if (fstat(fd, &st) || (static_cast<std::size_t>(st.st_size)
+			< sizeof(SharedMemoryHeader))) {
+		HV_WARN("Invalid shared-memory segment " << segmentName)
+		::close(fd);
+		return false;
+	}
+	void *addr = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ,
+			MAP_SHARED, fd, 0);
+	::close(fd);
+	if (addr == MAP_FAILED) {
+		HV_WARN("Could not map shared-memory segment " << segmentName)
+		return false;
+	}
+	segment = static_cast<const hvuint8_t*>(addr);
+	segmentSize = static_cast<std::size_t>(st.st_size);
+	const SharedMemoryHeader *header = this->getHeader();
+	if (std::memcmp(header->magic, shmMagic, sizeof(shmMagic))
+			|| (header->version != RegisterFileSharedMemory::version)
+			|| (header->segmentSize > segmentSize)) {
+		HV_WARN("Unsupported shared-memory segment layout in " << segmentName)
+		this->close();
+		return false;
+	}
+	// Entries, names and values must all lie in the mapping
+	bool valid = (header->entrySize >= sizeof(SharedMemoryEntry))
+			&& fitsInSegment(header->entriesOffset, 0u,
+					static_cast<hvuint64_t>(header->registerCount)
+							* header->entrySize, segmentSize);
+	for (std::size_t i = 0; valid && (i < header->registerCount); i++) {
+		const SharedMemoryEntry &entry = this->getEntry(i);
+		valid = fitsInSegment(header->stringsOffset, entry.nameOffset,
+				entry.nameLength, segmentSize)
+				&& fitsInSegment(header->valuesOffset, entry.valueOffset,
+						HV_BIT_TO_BYTE(
+								static_cast<hvuint64_t>(entry.sizeInBits)),
+						segmentSize);
+	}
+	if (!valid) {
+		HV_WARN("Corrupted shared-memory segment " << segmentName)
+		this->close();
+		return false;
+	}
+	for (std::size_t i = 0; i < header->registerCount; i++) {
+		index[this->getEntry(i).address] = i;
+	}
+	return true;
+#else
+	HV_WARN("Shared-memory export is not supported on this platform")
+	return false;
+#endif
+}
+
+void RegisterFileSharedMemoryReader::close() {
+#ifdef HV_REG_HAS_SHARED_MEMORY
+	if (segment != nullptr) {
+		munmap(const_cast<hvuint8_t*>(segment), segmentSize);
+	}
+#endif
+	segment = nullptr;
+	segmentSize = 0u;
+	index.clear();
+}
+
+const SharedMemoryHeader* RegisterFileSharedMemoryReader::getHeader() const {
+	return reinterpret_cast<const SharedMemoryHeader*>(segment);
+}
+
+std::size_t RegisterFileSharedMemoryReader::getRegisterCount() const {
+	return segment ? this->getHeader()->registerCount : 0u;
+}
+
+std::string RegisterFileSharedMemoryReader::getRegisterName(
+		const std::size_t &ind) const {
+	HV_ASSERT(ind < this->getRegisterCount(), "Register index out of range")
+	const SharedMemoryEntry &entry = this->getEntry(ind);
+	return std::string(
+			reinterpret_cast<const char*>(segment
+					+ this->getHeader()->stringsOffset + entry.nameOffset),
+			entry.nameLength);
+}
+
+hvaddr_t RegisterFileSharedMemoryReader::getRegisterAddress(
+		const std::size_t &ind) const {
+	HV_ASSERT(ind < this->getRegisterCount(), "Register index out of range")
+	return this->getEntry(ind).address;
+}
+
+bool RegisterFileSharedMemoryReader::read(const hvaddr_t &address,
+		hvuint8_t* readBuff, const std::size_t &readSize, hvuint64_t* epoch) const {
+	std::unordered_map<hvaddr_t, std::size_t>::const_iterator it = index.find(
+			address);
+	if (it == index.cend()) {
+		return false;
+	}
+	const SharedMemoryHeader *header = this->getHeader();
+	const SharedMemoryEntry &entry = this->getEntry(it->second);
+	std::size_t size = HV_MIN(readSize,
+			static_cast<std::size_t>(HV_BIT_TO_BYTE(entry.sizeInBits)));
+	const std::atomic<hvuint64_t> &seq = sequenceOf(header);
+	for (unsigned int i = 0; i < maxReadAttempts; i++) {
+		if (i) {
+			// Writer is updating values: let it run
+			std::this_thread::yield();
+		}
+		hvuint64_t seq1 = seq.load(std::memory_order_acquire);
+		if (seq1 & 1u) {
+			continue;
+		}
+		std::memcpy(readBuff,
+				segment + header->valuesOffset + entry.valueOffset, size);
+		hvuint64_t epochTmp = header->epoch;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (seq.load(std::memory_order_relaxed) == seq1) {
+			if (epoch != nullptr) {
+				*epoch = epochTmp;
+			}
+			return true;
+		}
+	}
+	HV_WARN("No consistent value of shared register @0x" << std::hex << address)
+	return false;
+}
+
+const SharedMemoryEntry& RegisterFileSharedMemoryReader::getEntry(
+		const std::size_t &ind) const {
+	const SharedMemoryHeader *header = this->getHeader();
+	return *reinterpret_cast<const SharedMemoryEntry*>(segment
+			+ header->entriesOffset + ind * header->entrySize);
+}
+
+} // namespace reg
+} // namespace hv
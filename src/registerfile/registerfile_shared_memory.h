@@ -0,0 +1,423 @@
+/**
+ * @file registerfile_shared_memory.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Shared-memory export of RegisterFile values
+ */
+
+#ifndef HV_REGISTERFILE_SHARED_MEMORY_H_
+#define HV_REGISTERFILE_SHARED_MEMORY_H_
+
+#include <atomic>
+#include <vector>
+#include <unordered_map>
+#include <hv/common.h>
+
+#include "registerfile.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * Shared-memory segment header
+ *
+ * A segment is made of this header, followed by registerCount entries
+ * (SharedMemoryEntry), a string table holding register names and the
+ * value area holding register values (LSB first).
+ * All offsets are in bytes from the beginning of the segment.
+ * Values are guarded by sequence: a reader must retry its copy if sequence
+ * was odd or changed during the copy.
+ */
+struct SharedMemoryHeader {
+	/**
+	 * Segment identifier, always "HVREGSHM"
+	 */
+	char magic[8];
+
+	/**
+	 * Layout version
+	 */
+	::hv::common::hvuint32_t version;
+
+	/**
+	 * Size of this header in bytes
+	 */
+	::hv::common::hvuint32_t headerSize;
+
+	/**
+	 * Sequence counter (odd while values are being updated)
+	 */
+	::hv::common::hvuint64_t sequence;
+
+	/**
+	 * Number of publications
+	 */
+	::hv::common::hvuint64_t epoch;
+
+	/**
+	 * Number of exported registers
+	 */
+	::hv::common::hvuint32_t registerCount;
+
+	/**
+	 * Size of one entry in bytes
+	 */
+	::hv::common::hvuint32_t entrySize;
+
+	/**
+	 * Offset of entry table
+	 */
+	::hv::common::hvuint64_t entriesOffset;
+
+	/**
+	 * Offset of string table
+	 */
+	::hv::common::hvuint64_t stringsOffset;
+
+	/**
+	 * Offset of value area
+	 */
+	::hv::common::hvuint64_t valuesOffset;
+
+	/**
+	 * Size of value area in bytes
+	 */
+	::hv::common::hvuint64_t valuesSize;
+
+	/**
+	 * Total segment size in bytes
+	 */
+	::hv::common::hvuint64_t segmentSize;
+};
+
+/**
+ * Shared-memory segment entry describing one register
+ */
+struct SharedMemoryEntry {
+	/**
+	 * Register address relatively to exported register file
+	 */
+	::hv::common::hvuint64_t address;
+
+	/**
+	 * Offset of register value in value area
+	 */
+	::hv::common::hvuint64_t valueOffset;
+
+	/**
+	 * Register size in bits
+	 */
+	::hv::common::hvuint32_t sizeInBits;
+
+	/**
+	 * Offset of register name in string table
+	 */
+	::hv::common::hvuint32_t nameOffset;
+
+	/**
+	 * Register name length (no terminating null character is counted)
+	 */
+	::hv::common::hvuint32_t nameLength;
+
+	/**
+	 * Reserved
+	 */
+	::hv::common::hvuint32_t reserved;
+};
+
+/**
+ * RegisterFileSharedMemory class
+ *
+ * Exports register values of a RegisterFile hierarchy to a POSIX
+ * shared-memory segment. Processes on the same host can map the segment
+ * read-only and inspect register state without any IPC round trip.
+ * Values are written to the segment when publish() is called, and only
+ * modified registers are copied.
+ *
+ * Shared memory is only supported on POSIX systems. Elsewhere, open() fails.
+ */
+class RegisterFileSharedMemory {
+public:
+//** Constants **//
+	/**
+	 * Current layout version
+	 */
+	static const ::hv::common::hvuint32_t version = 1u;
+
+//** Constructors **//
+	/**
+	 * RegisterFileSharedMemory constructor
+	 * @param regFileIn Register file to export
+	 */
+	RegisterFileSharedMemory(const RegisterFile &regFileIn);
+
+	RegisterFileSharedMemory(const RegisterFileSharedMemory &) = delete;
+	RegisterFileSharedMemory& operator=(const RegisterFileSharedMemory &) = delete;
+
+//** Destructor **//
+	/**
+	 * Destructor, closes and unlinks segment
+	 */
+	virtual ~RegisterFileSharedMemory();
+
+//** Segment management **//
+	/**
+	 * Create segment and publish all register values
+	 *
+	 * Exported layout is the one of the register file when this method is called.
+	 * An existing segment with the same name is never truncated: open() fails,
+	 * unless replace is set. Then the existing segment is unlinked (readers
+	 * mapping it keep the old content) and a new one is created.
+	 * @param segmentNameIn POSIX shared-memory object name (e.g. "/myModuleRegs")
+	 * @param replace Unlink and recreate an existing segment if true
+	 * @return true if success, false else
+	 */
+	bool open(const std::string &segmentNameIn, const bool &replace = false);
+
+	/**
+	 * Unmap and unlink segment
+	 *
+	 * Segment name is not unlinked if it was replaced by another segment.
+	 */
+	void close();
+
+	/**
+	 * Check if segment is open
+	 * @return true if segment is open
+	 */
+	bool isOpen() const;
+
+	/**
+	 * Get segment name
+	 * @return Segment name
+	 */
+	std::string getSegmentName() const;
+
+	/**
+	 * Get segment size in bytes
+	 * @return Segment size in bytes
+	 */
+	std::size_t getSegmentSize() const;
+
+//** Publication **//
+	/**
+	 * Publish all register values modified since last publication
+	 * @return Number of registers published
+	 */
+	std::size_t publish();
+
+	/**
+	 * Publish value of one register if it was modified
+	 * @param address Register address
+	 * @return true if register was published, false if unchanged or not exported
+	 */
+	bool publish(const ::hv::common::hvaddr_t &address);
+
+	/**
+	 * Publish value of one register if it was modified
+	 *
+	 * Register is found whatever address it was accessed at (e.g. through
+	 * another address space aliasing exported register file).
+	 * @param reg Register
+	 * @return true if register was published, false if unchanged or not exported
+	 */
+	bool publish(const Register &reg);
+
+protected:
+	/**
+	 * Publish value of one register if it was modified
+	 * @param ind Register index
+	 * @return true if register was published, false if unchanged
+	 */
+	bool publishEntry(const std::size_t &ind);
+
+	/**
+	 * Open a publication window (sequence becomes odd)
+	 */
+	void beginUpdate();
+
+	/**
+	 * Close a publication window (sequence becomes even)
+	 */
+	void endUpdate();
+
+	/**
+	 * Copy register value to segment
+	 * @param ind Register index
+	 * @param value Register value (see valueOf())
+	 */
+	void update(const std::size_t &ind, const void *value);
+
+	/**
+	 * Get current value of an exported register
+	 *
+	 * Values computed on demand are evaluated in scratch buffer.
+	 * @param ind Register index
+	 * @return Address of register value, valid until next call
+	 */
+	const void* valueOf(const std::size_t &ind);
+
+	/**
+	 * Exported register file
+	 */
+	const RegisterFile &regFile;
+
+	/**
+	 * Segment name
+	 */
+	std::string segmentName;
+
+	/**
+	 * Mapped segment
+	 */
+	::hv::common::hvuint8_t* segment;
+
+	/**
+	 * Segment size in bytes
+	 */
+	std::size_t segmentSize;
+
+	/**
+	 * Device and inode of segment (identify it when name is reused)
+	 */
+	::hv::common::hvuint64_t segmentDevice;
+	::hv::common::hvuint64_t segmentInode;
+
+	/**
+	 * Exported registers (same order as segment entries)
+	 */
+	std::vector<const Register*> sources;
+
+	/**
+	 * Value offsets in segment (same order as sources)
+	 */
+	std::vector<std::size_t> offsets;
+
+	/**
+	 * Evaluation buffer of values computed on demand
+	 */
+	std::vector<::hv::common::hvuint8_t> scratch;
+
+	/**
+	 * Map address/register index
+	 */
+	std::unordered_map<::hv::common::hvaddr_t, std::size_t> index;
+
+	/**
+	 * Map register/register index
+	 */
+	std::unordered_map<const Register*, std::size_t> registerIndex;
+};
+
+/**
+ * RegisterFileSharedMemoryReader class
+ *
+ * Maps a segment exported by RegisterFileSharedMemory read-only.
+ * It can be used from another process.
+ */
+class RegisterFileSharedMemoryReader {
+public:
+//** Constants **//
+	/**
+	 * Maximum number of copy attempts of read() while values are updated
+	 */
+	static const unsigned int maxReadAttempts = 1024u;
+
+//** Constructors **//
+	RegisterFileSharedMemoryReader();
+
+	RegisterFileSharedMemoryReader(const RegisterFileSharedMemoryReader &) = delete;
+	RegisterFileSharedMemoryReader& operator=(
+			const RegisterFileSharedMemoryReader &) = delete;
+
+//** Destructor **//
+	virtual ~RegisterFileSharedMemoryReader();
+
+//** Segment management **//
+	/**
+	 * Map an existing segment
+	 *
+	 * Entry table, register names and values must all lie in the segment.
+	 * @param segmentName POSIX shared-memory object name
+	 * @return true if segment was mapped and its layout is valid
+	 */
+	bool open(const std::string &segmentName);
+
+	/**
+	 * Unmap segment
+	 */
+	void close();
+
+//** Accessors **//
+	/**
+	 * Get segment header
+	 * @return Pointer to header, nullptr if no segment is mapped
+	 */
+	const SharedMemoryHeader* getHeader() const;
+
+	/**
+	 * Get number of exported registers
+	 * @return Number of exported registers
+	 */
+	std::size_t getRegisterCount() const;
+
+	/**
+	 * Get name of exported register
+	 * @param ind Register index
+	 * @return Register name
+	 */
+	std::string getRegisterName(const std::size_t &ind) const;
+
+	/**
+	 * Get address of exported register
+	 * @param ind Register index
+	 * @return Register address
+	 */
+	::hv::common::hvaddr_t getRegisterAddress(const std::size_t &ind) const;
+
+	/**
+	 * Read consistent value of a register
+	 *
+	 * Copy is retried while values are updated, yielding the processor
+	 * between attempts, up to maxReadAttempts times.
+	 * @param address Register address
+	 * @param readBuff Read buffer
+	 * @param readSize Read size in bytes
+	 * @param epoch If not nullptr, receives the epoch of the value read
+	 * @return true if success, false if register is not exported or no
+	 * consistent value could be read (writer stalled in an update)
+	 */
+	bool read(const ::hv::common::hvaddr_t &address,
+			::hv::common::hvuint8_t* readBuff, const std::size_t &readSize,
+			::hv::common::hvuint64_t* epoch = nullptr) const;
+
+protected:
+	/**
+	 * Get entry of entry table, whatever entry size of segment layout
+	 * @param ind Entry index
+	 * @return Entry
+	 */
+	const SharedMemoryEntry& getEntry(const std::size_t &ind) const;
+
+	/**
+	 * Mapped segment
+	 */
+	const ::hv::common::hvuint8_t* segment;
+
+	/**
+	 * Mapped size in bytes
+	 */
+	std::size_t segmentSize;
+
+	/**
+	 * Map address/entry index
+	 */
+	std::unordered_map<::hv::common::hvaddr_t, std::size_t> index;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_REGISTERFILE_SHARED_MEMORY_H_ */
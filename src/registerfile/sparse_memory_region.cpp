@@ -0,0 +1,206 @@
+/**
+ * @file sparse_memory_region.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Memory region backed by lazily allocated pages
+ */
+
+#include <cstring>
+
+#include "sparse_memory_region.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+SparseMemoryRegion::SparseMemoryRegion(const std::size_t &sizeIn,
+		const std::string &nameIn, const std::string &descriptionIn,
+		const std::size_t &pageSizeIn, const hvuint8_t &fillIn) :
+		name(nameIn), description(descriptionIn), size(sizeIn), pageSize(
+				pageSizeIn), fill(fillIn), lastIndex(0u), lastPage(nullptr) {
+	if (size == 0u) {
+		HV_ERR("Sparse memory region " << nameIn << " has no byte")
+		exit(EXIT_FAILURE);
+	}
+	if ((pageSize == 0u) || ((pageSize & (pageSize - 1u)) != 0u)) {
+		HV_ERR(
+				"Page size of sparse memory region " << nameIn << " must be a power of 2")
+		exit(EXIT_FAILURE);
+	}
+}
+
+SparseMemoryRegion::~SparseMemoryRegion() {
+}
+
+std::string SparseMemoryRegion::getName() const {
+	return name;
+}
+
+std::string SparseMemoryRegion::getDescription() const {
+	return description;
+}
+
+std::size_t SparseMemoryRegion::getSizeInBytes() const {
+	return size;
+}
+
+std::size_t SparseMemoryRegion::getPageSize() const {
+	return pageSize;
+}
+
+hvuint8_t SparseMemoryRegion::getFill() const {
+	return fill;
+}
+
+std::size_t SparseMemoryRegion::getAllocatedPageCount() const {
+	return pages.size();
+}
+
+bool SparseMemoryRegion::read(const hvaddr_t &offset, hvuint8_t* readBuff,
+		const std::size_t &readSize) {
+	this->debugRead(offset, readBuff, readSize);
+	return true;
+}
+
+bool SparseMemoryRegion::write(const hvaddr_t &offset,
+		const hvuint8_t* writeBuff, const std::size_t &writeSize) {
+	this->debugWrite(offset, writeBuff, writeSize);
+	return true;
+}
+
+void SparseMemoryRegion::debugRead(const hvaddr_t &offset,
+		hvuint8_t* readBuff, const std::size_t &readSize) const {
+	this->checkAccess(offset, readSize);
+	std::size_t done(0u);
+	while (done < readSize) {
+		const std::size_t index((offset + done) / pageSize);
+		const std::size_t inner((offset + done) % pageSize);
+		const std::size_t chunk(HV_MIN(readSize - done, pageSize - inner));
+		// Pages never written are not allocated by reads
+		const hvuint8_t *page(this->findPage(index));
+		if (page != nullptr) {
+			std::memcpy(readBuff + done, page + inner, chunk);
+		} else {
+			std::memset(readBuff + done, fill, chunk);
+		}
+		done += chunk;
+	}
+}
+
+void SparseMemoryRegion::debugWrite(const hvaddr_t &offset,
+		const hvuint8_t* writeBuff, const std::size_t &writeSize) {
+	this->checkAccess(offset, writeSize);
+	std::size_t done(0u);
+	while (done < writeSize) {
+		const std::size_t index((offset + done) / pageSize);
+		const std::size_t inner((offset + done) % pageSize);
+		const std::size_t chunk(HV_MIN(writeSize - done, pageSize - inner));
+		std::memcpy(this->allocatePage(index) + inner, writeBuff + done, chunk);
+		done += chunk;
+	}
+}
+
+hvuint8_t* SparseMemoryRegion::getDirectMemPtr(const hvaddr_t &offset,
+		hvaddr_t &startOffset, hvaddr_t &endOffset) {
+	this->checkAccess(offset, 1u);
+	const std::size_t index(offset / pageSize);
+	startOffset = index * pageSize;
+	endOffset = HV_MIN(startOffset + pageSize, size) - 1u;
+	return this->allocatePage(index);
+}
+
+void SparseMemoryRegion::clear() {
+	for (pmap_t::iterator it = pages.begin(); it != pages.end();) {
+		it = this->freePage(it);
+	}
+}
+
+SparseMemoryRegion::Snapshot SparseMemoryRegion::takeSnapshot() const {
+	Snapshot ret;
+	ret.pageSize = pageSize;
+	for (pmap_t::const_iterator it = pages.cbegin(); it != pages.cend(); ++it) {
+		ret.pages[it->first].assign(it->second.get(),
+				it->second.get() + pageSize);
+	}
+	return ret;
+}
+
+bool SparseMemoryRegion::restoreSnapshot(const Snapshot &snapshot) {
+	if (snapshot.pageSize != pageSize) {
+		HV_WARN(
+				"Snapshot page size does not match page size of sparse memory region " << name)
+		return false;
+	}
+	if (!snapshot.pages.empty()
+			&& (snapshot.pages.crbegin()->first * pageSize >= size)) {
+		HV_WARN("Snapshot does not fit in sparse memory region " << name)
+		return false;
+	}
+	for (pmap_t::iterator it = pages.begin(); it != pages.end();) {
+		if (snapshot.pages.find(it->first) == snapshot.pages.cend()) {
+			it = this->freePage(it);
+		} else {
+			++it;
+		}
+	}
+	// Pages kept are copied in place: their DMI pointers stay valid
+	for (std::map<std::size_t, std::vector<hvuint8_t> >::const_iterator it =
+			snapshot.pages.cbegin(); it != snapshot.pages.cend(); ++it) {
+		std::memcpy(this->allocatePage(it->first), it->second.data(),
+				pageSize);
+	}
+	return true;
+}
+
+hvuint8_t* SparseMemoryRegion::findPage(const std::size_t &index) const {
+	if ((lastPage != nullptr) && (lastIndex == index)) {
+		return lastPage;
+	}
+	pmap_t::const_iterator it = pages.find(index);
+	if (it == pages.cend()) {
+		return nullptr;
+	}
+	lastIndex = index;
+	lastPage = it->second.get();
+	return lastPage;
+}
+
+hvuint8_t* SparseMemoryRegion::allocatePage(const std::size_t &index) {
+	hvuint8_t *ret(this->findPage(index));
+	if (ret != nullptr) {
+		return ret;
+	}
+	std::unique_ptr<hvuint8_t[]> &page(pages[index]);
+	page.reset(new hvuint8_t[pageSize]);
+	std::memset(page.get(), fill, pageSize);
+	lastIndex = index;
+	lastPage = page.get();
+	return lastPage;
+}
+
+SparseMemoryRegion::pmap_t::iterator SparseMemoryRegion::freePage(
+		pmap_t::iterator it) {
+	const hvaddr_t start(it->first * pageSize);
+	if (lastPage == it->second.get()) {
+		lastPage = nullptr;
+	}
+	it = pages.erase(it);
+	this->notifyDirectMemoryInvalidation(start,
+			HV_MIN(start + pageSize, size) - 1u);
+	return it;
+}
+
+void SparseMemoryRegion::checkAccess(const hvaddr_t &offset,
+		const std::size_t &accessSize) const {
+	if ((offset >= size) || (accessSize > size - offset)) {
+		HV_ERR(
+				"Access at offset 0x" << std::hex << offset << " of " << std::dec << accessSize << " bytes is out of sparse memory region " << name)
+		exit(EXIT_FAILURE);
+	}
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,201 @@
+/**
+ * @file sparse_memory_region.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Memory region backed by lazily allocated pages
+ *
+ * SRAM windows, mailboxes and message buffers are plain byte storage: they do
+ * not need one Register object per word. A sparse memory region stores its
+ * content in fixed-size pages allocated on first write. Pages never written
+ * cost no memory and read as the fill byte. Accesses are copied page by page.
+ */
+
+#ifndef HV_SPARSE_MEMORY_REGION_H_
+#define HV_SPARSE_MEMORY_REGION_H_
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <hv/common.h>
+
+#include "address_region.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * SparseMemoryRegion class
+ *
+ * Accesses have no side effect: RegModule grants read/write DMI pointers on
+ * pages of a sparse memory region. Pages are only freed by clear() and
+ * restoreSnapshot(), which invalidate DMI pointers on them.
+ */
+class SparseMemoryRegion: public AddressRegion {
+public:
+//** Type definitions **//
+	/**
+	 * Content of allocated pages at snapshot time
+	 */
+	struct Snapshot {
+		std::size_t pageSize;
+
+		/**
+		 * Page contents, by page index
+		 */
+		std::map<std::size_t, std::vector<::hv::common::hvuint8_t> > pages;
+	};
+
+//** Constructors **//
+	/**
+	 * SparseMemoryRegion constructor
+	 * @param sizeIn Region size in bytes
+	 * @param nameIn Region name
+	 * @param descriptionIn Region description
+	 * @param pageSizeIn Page size in bytes (power of 2)
+	 * @param fillIn Value of bytes never written
+	 */
+	SparseMemoryRegion(const std::size_t &sizeIn, const std::string &nameIn,
+			const std::string &descriptionIn = std::string(""),
+			const std::size_t &pageSizeIn = 4096u,
+			const ::hv::common::hvuint8_t &fillIn = 0u);
+
+	SparseMemoryRegion(const SparseMemoryRegion &) = delete;
+	SparseMemoryRegion& operator=(const SparseMemoryRegion &) = delete;
+
+//** Destructor **//
+	virtual ~SparseMemoryRegion();
+
+//** Accessors **//
+	std::string getName() const override;
+
+	std::string getDescription() const override;
+
+	std::size_t getSizeInBytes() const override;
+
+	std::size_t getPageSize() const;
+
+	::hv::common::hvuint8_t getFill() const;
+
+	/**
+	 * Get number of allocated pages
+	 * @return Number of pages written at least once since last clear
+	 */
+	std::size_t getAllocatedPageCount() const;
+
+//** Read/Write **//
+	bool read(const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvuint8_t* readBuff, const std::size_t &readSize)
+					override;
+
+	bool write(const ::hv::common::hvaddr_t &offset,
+			const ::hv::common::hvuint8_t* writeBuff,
+			const std::size_t &writeSize) override;
+
+//** Debug access **//
+	void debugRead(const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvuint8_t* readBuff, const std::size_t &readSize) const
+					override;
+
+	void debugWrite(const ::hv::common::hvaddr_t &offset,
+			const ::hv::common::hvuint8_t* writeBuff,
+			const std::size_t &writeSize) override;
+
+//** Direct memory access **//
+	/**
+	 * Get direct memory pointer on page including offset
+	 *
+	 * Page is allocated if needed, so that writes through pointer are kept.
+	 * @param offset Offset from region start
+	 * @param startOffset Set to page start offset
+	 * @param endOffset Set to page end offset (included)
+	 * @return Pointer on page storage
+	 */
+	::hv::common::hvuint8_t* getDirectMemPtr(
+			const ::hv::common::hvaddr_t &offset,
+			::hv::common::hvaddr_t &startOffset,
+			::hv::common::hvaddr_t &endOffset) override;
+
+//** Memory management **//
+	/**
+	 * Free all pages, whole region reads as fill byte again
+	 */
+	void clear();
+
+	/**
+	 * Copy content of allocated pages
+	 * @return Snapshot of region
+	 */
+	Snapshot takeSnapshot() const;
+
+	/**
+	 * Restore region content from a snapshot
+	 *
+	 * Pages allocated since snapshot are freed, other pages are copied back
+	 * in place.
+	 * @param snapshot Snapshot taken on a region with same size and page size
+	 * @return true if success, false if snapshot does not fit region
+	 */
+	bool restoreSnapshot(const Snapshot &snapshot);
+
+protected:
+	typedef std::unordered_map<std::size_t,
+			std::unique_ptr<::hv::common::hvuint8_t[]> > pmap_t;
+
+	/**
+	 * Get page storage
+	 * @param index Page index
+	 * @return Pointer on page, nullptr if page is not allocated
+	 */
+	::hv::common::hvuint8_t* findPage(const std::size_t &index) const;
+
+	/**
+	 * Get page storage, allocating page if needed
+	 * @param index Page index
+	 * @return Pointer on page
+	 */
+	::hv::common::hvuint8_t* allocatePage(const std::size_t &index);
+
+	/**
+	 * Free a page and invalidate direct memory pointers on it
+	 * @param it Page to free
+	 * @return Iterator following freed page
+	 */
+	pmap_t::iterator freePage(pmap_t::iterator it);
+
+	/**
+	 * Check that an access is within region, exits else
+	 * @param offset Access offset
+	 * @param accessSize Access size in bytes
+	 */
+	void checkAccess(const ::hv::common::hvaddr_t &offset,
+			const std::size_t &accessSize) const;
+
+	std::string name;
+
+	std::string description;
+
+	const std::size_t size;
+
+	const std::size_t pageSize;
+
+	const ::hv::common::hvuint8_t fill;
+
+	/**
+	 * Allocated pages, by page index
+	 */
+	pmap_t pages;
+
+	/**
+	 * Last page found, consecutive accesses usually hit the same page
+	 */
+	mutable std::size_t lastIndex;
+	mutable ::hv::common::hvuint8_t *lastPage;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_SPARSE_MEMORY_REGION_H_ */
@@ -0,0 +1,145 @@
+/**
+ * @file address_decoder.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Transport address decoder of a register file
+ */
+
+#include "address_decoder.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+AddressDecoder::AddressDecoder(RegisterFile &regFileIn) :
+		regFile(regFileIn), revision(regFileIn.getRevision()), hits(0u), misses(
+				0u) {
+	this->flush();
+}
+
+AddressDecoder::~AddressDecoder() {
+}
+
+Register* AddressDecoder::decode(const hvaddr_t &address,
+		const AccessLatency **latency, const AccessPermission **permission) {
+	const Entry &entry(this->lookup(address));
+	if (latency != nullptr) {
+		*latency = entry.latency;
+	}
+	if (permission != nullptr) {
+		*permission = &entry.permission;
+	}
+	return entry.reg;
+}
+
+const AddressDecoder::Entry& AddressDecoder::lookup(const hvaddr_t &address) {
+	if (revision != regFile.getRevision()) {
+		this->flush();
+		revision = regFile.getRevision();
+	}
+	Entry &entry(cache[slotOf(address)]);
+	if (entry.valid && (entry.address == address)) {
+		hits++;
+	} else {
+		misses++;
+		entry.valid = true;
+		entry.address = address;
+		entry.reg = regFile.tryGetRegister(address);
+		entry.latency = &this->getAccessLatency(address);
+		entry.permission = regFile.getAccessPermission(address);
+		// Callback ranges may start inside register
+		entry.rangeCallbacks = regFile.hasRangeCallbacks(address,
+				entry.reg ? entry.reg->getSizeInBytes() : 1u);
+		entry.regionOffset = 0u;
+		entry.region =
+				entry.reg ?
+						nullptr :
+						regFile.tryGetRegion(address, &entry.regionOffset);
+		entry.insideRegister = (entry.reg == nullptr)
+				&& (entry.region == nullptr)
+				&& (regFile.tryGetEnclosingRegister(address) != nullptr);
+	}
+	return entry;
+}
+
+std::size_t AddressDecoder::slotOf(const hvaddr_t &address) {
+	// Folded down to 4 bits, one value per cache entry
+	hvuint64_t folded(address);
+	folded ^= folded >> 32;
+	folded ^= folded >> 16;
+	folded ^= folded >> 8;
+	folded ^= folded >> 4;
+	return static_cast<std::size_t>(folded & 0xFu);
+}
+
+void AddressDecoder::flush() {
+	cache.fill(
+			Entry { false, 0u, nullptr, nullptr, AccessPermission(), false,
+					nullptr, 0u, false });
+}
+
+void AddressDecoder::setAccessLatency(const ::sc_core::sc_time &read,
+		const ::sc_core::sc_time &write) {
+	defaultLatency = AccessLatency(read, write);
+}
+
+void AddressDecoder::setRangeAccessLatency(const hvaddr_t &start,
+		const hvaddr_t &end, const ::sc_core::sc_time &read,
+		const ::sc_core::sc_time &write) {
+	if (end < start) {
+		HV_ERR(
+				"Latency range end address 0x" << std::hex << end << " is lower than start address 0x" << start)
+		exit(EXIT_FAILURE);
+	}
+	rangeLatencies.push_back(
+			RangeLatency { start, end, AccessLatency(read, write) });
+	this->flush();
+}
+
+void AddressDecoder::setRegisterAccessLatency(const hvaddr_t &address,
+		const ::sc_core::sc_time &read, const ::sc_core::sc_time &write) {
+	registerLatencies[address] = AccessLatency(read, write);
+	this->flush();
+}
+
+void AddressDecoder::clearAccessLatencies() {
+	defaultLatency = AccessLatency();
+	registerLatencies.clear();
+	rangeLatencies.clear();
+	this->flush();
+}
+
+const AccessLatency& AddressDecoder::getAccessLatency(
+		const hvaddr_t &address) const {
+	std::unordered_map<hvaddr_t, AccessLatency>::const_iterator it =
+			registerLatencies.find(address);
+	if (it != registerLatencies.cend()) {
+		return it->second;
+	}
+	for (std::vector<RangeLatency>::const_reverse_iterator range =
+			rangeLatencies.crbegin(); range != rangeLatencies.crend();
+			++range) {
+		if ((address >= range->start) && (address <= range->end)) {
+			return range->latency;
+		}
+	}
+	return defaultLatency;
+}
+
+RegisterFile& AddressDecoder::getRegisterFile() const {
+	return regFile;
+}
+
+hvuint64_t AddressDecoder::getHits() const {
+	return hits;
+}
+
+hvuint64_t AddressDecoder::getMisses() const {
+	return misses;
+}
+
+} // namespace reg
+} // namespace hv
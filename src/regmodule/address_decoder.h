@@ -0,0 +1,248 @@
+/**
+ * @file address_decoder.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Transport address decoder of a register file
+ */
+
+#ifndef HV_ADDRESS_DECODER_H_
+#define HV_ADDRESS_DECODER_H_
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+#include <systemc>
+#include <hv/common.h>
+
+#include "../registerfile/registerfile.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * Latencies of transport accesses to a register
+ */
+struct AccessLatency {
+	AccessLatency() :
+			read(::sc_core::SC_ZERO_TIME), write(::sc_core::SC_ZERO_TIME) {
+	}
+
+	AccessLatency(const ::sc_core::sc_time &readIn,
+			const ::sc_core::sc_time &writeIn) :
+			read(readIn), write(writeIn) {
+	}
+
+	::sc_core::sc_time read;
+	::sc_core::sc_time write;
+};
+
+/**
+ * AddressDecoder class
+ *
+ * Decodes transport addresses of one register file through a small
+ * direct-mapped cache and resolves access latencies and access permissions
+ * of decoded addresses.
+ * Several decoders can share registers: a register inserted in several
+ * register files is decoded at its address in each of them.
+ */
+class AddressDecoder {
+public:
+//** Constructors **//
+	/**
+	 * AddressDecoder constructor
+	 * @param regFileIn Decoded register file
+	 */
+	AddressDecoder(RegisterFile &regFileIn);
+
+	AddressDecoder(const AddressDecoder &) = delete;
+	AddressDecoder& operator=(const AddressDecoder &) = delete;
+
+//** Destructor **//
+	virtual ~AddressDecoder();
+
+//** Decoding **//
+	/**
+	 * Get register at address
+	 *
+	 * Cache is flushed when register file layout, access rules or access
+	 * latencies change. Misses are cached as well.
+	 * @param address Register address
+	 * @param latency If not nullptr, set to access latency of address
+	 * @param permission If not nullptr, set to access permission of address
+	 * @return Pointer to register, nullptr if no register starts at address
+	 */
+	Register* decode(const ::hv::common::hvaddr_t &address,
+			const AccessLatency **latency = nullptr,
+			const AccessPermission **permission = nullptr);
+
+	/**
+	 * Decoding of an address
+	 */
+	struct Entry {
+		bool valid;
+		::hv::common::hvaddr_t address;
+		/**
+		 * Decoded register, nullptr if no register starts at address
+		 */
+		Register *reg;
+
+		const AccessLatency *latency;
+
+		/**
+		 * Permission compiled from access rules of register file
+		 */
+		AccessPermission permission;
+
+		/**
+		 * true if address-range callbacks of register file cover part of
+		 * register starting at address (or address itself if none)
+		 */
+		bool rangeCallbacks;
+
+		/**
+		 * Region containing address when no register starts at it, nullptr
+		 * else
+		 */
+		AddressRegion *region;
+
+		/**
+		 * Offset of address in region
+		 */
+		::hv::common::hvaddr_t regionOffset;
+
+		/**
+		 * true if address falls inside a register without being its start
+		 */
+		bool insideRegister;
+	};
+
+	/**
+	 * Get decoding of an address (see decode())
+	 *
+	 * Returned entry may be overwritten by next lookup: it must be copied
+	 * if accesses are performed before its last use.
+	 * @param address Register address
+	 * @return Cache entry of address
+	 */
+	const Entry& lookup(const ::hv::common::hvaddr_t &address);
+
+	/**
+	 * Invalidate all cache entries
+	 */
+	void flush();
+
+//** Latencies **//
+	/**
+	 * Set latency of accesses to registers with no more specific latency
+	 * @param read Read latency
+	 * @param write Write latency
+	 */
+	void setAccessLatency(const ::sc_core::sc_time &read,
+			const ::sc_core::sc_time &write);
+
+	/**
+	 * Set latency of accesses to registers starting in an address range
+	 *
+	 * When ranges overlap, the latest one applies. Register latencies take
+	 * precedence over range latencies.
+	 * @param start Range start address
+	 * @param end Range end address (included)
+	 * @param read Read latency
+	 * @param write Write latency
+	 */
+	void setRangeAccessLatency(const ::hv::common::hvaddr_t &start,
+			const ::hv::common::hvaddr_t &end, const ::sc_core::sc_time &read,
+			const ::sc_core::sc_time &write);
+
+	/**
+	 * Set latency of accesses to register starting at an address
+	 * @param address Register address
+	 * @param read Read latency
+	 * @param write Write latency
+	 */
+	void setRegisterAccessLatency(const ::hv::common::hvaddr_t &address,
+			const ::sc_core::sc_time &read, const ::sc_core::sc_time &write);
+
+	/**
+	 * Remove all access latencies
+	 */
+	void clearAccessLatencies();
+
+	/**
+	 * Get latency of accesses to an address
+	 * @param address Register address
+	 * @return Latency of register, else of latest range including address, else default latency
+	 */
+	const AccessLatency& getAccessLatency(
+			const ::hv::common::hvaddr_t &address) const;
+
+//** Accessors **//
+	/**
+	 * Get decoded register file
+	 * @return Decoded register file
+	 */
+	RegisterFile& getRegisterFile() const;
+
+	/**
+	 * Get number of decodes served by cache (including unmapped addresses)
+	 * @return Number of cache hits
+	 */
+	::hv::common::hvuint64_t getHits() const;
+
+	/**
+	 * Get number of decodes looked up in register file
+	 * @return Number of cache misses
+	 */
+	::hv::common::hvuint64_t getMisses() const;
+
+protected:
+
+	/**
+	 * Access latency of an address range
+	 */
+	struct RangeLatency {
+		::hv::common::hvaddr_t start;
+		::hv::common::hvaddr_t end;
+		AccessLatency latency;
+	};
+
+	RegisterFile &regFile;
+
+	/**
+	 * Get cache entry index of an address
+	 *
+	 * Address bits are xor-folded, so that neighbouring registers use
+	 * different entries whatever their size, stride and alignment.
+	 * @param address Register address
+	 * @return Cache entry index
+	 */
+	static std::size_t slotOf(const ::hv::common::hvaddr_t &address);
+
+	/**
+	 * Direct-mapped cache, indexed by slotOf()
+	 */
+	std::array<Entry, 16> cache;
+
+	/**
+	 * Register file revision when cache was filled
+	 */
+	::hv::common::hvuint64_t revision;
+
+	::hv::common::hvuint64_t hits, misses;
+
+	AccessLatency defaultLatency;
+
+	std::unordered_map<::hv::common::hvaddr_t, AccessLatency> registerLatencies;
+
+	/**
+	 * Range latencies, in order of definition
+	 */
+	std::vector<RangeLatency> rangeLatencies;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_ADDRESS_DECODER_H_ */
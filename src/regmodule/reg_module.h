@@ -10,24 +10,147 @@
 #ifndef HV_REGMODULE_H
 #define HV_REGMODULE_H
 
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <tlm>
 #include <hv/communication.h>
 #include <hv/module.h>
 
 #include "../registerfile/registerfile.h"
+#include "address_decoder.h"
+#include "../registerfile/registerfile_shared_memory.h"
+#include "../trace/access_trace_recorder.h"
 
 namespace hv {
 namespace reg {
 
+/**
+ * Native word type of a bus width, void if there is none
+ *
+ * Transactions of one bus word on a register of the same width are served by
+ * a single masked word copy (see RegModule::wordTransport()).
+ */
+template<unsigned int BUSWIDTH> struct BusWord {
+	typedef void type;
+};
+
+template<> struct BusWord<8> {
+	typedef ::hv::common::hvuint8_t type;
+};
+
+template<> struct BusWord<16> {
+	typedef ::hv::common::hvuint16_t type;
+};
+
+template<> struct BusWord<32> {
+	typedef ::hv::common::hvuint32_t type;
+};
+
+template<> struct BusWord<64> {
+	typedef ::hv::common::hvuint64_t type;
+};
+
 /**
  * RegModule class
  *
  * This class represents a register-based module
  * It contains a main register file mainRF
  */
-template<unsigned int BUSWIDTH = 32> class RegModule: public ::hv::module::Module {
+template<unsigned int BUSWIDTH = 32> class RegModule: public ::hv::module::Module,
+		public ::hv::reg::RegisterListener,
+		public ::hv::reg::AddressRegionListener {
 public:
 	typedef ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedProtocolTypes::tlm_payload_type mem_access_payload_type;
 
+	typedef typename BusWord<BUSWIDTH>::type bus_word_type;
+
+	typedef ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedSimpleTargetSocket<BUSWIDTH, ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedProtocolTypes, 0> mem_map_socket_type;
+
+	typedef ::std::function<::hv::reg::AccessAttributes(const mem_access_payload_type&)> access_attributes_extractor_type;
+
+	SC_HAS_PROCESS(RegModule);
+
+	/**
+	 * Behavior of transport accesses to addresses where no register starts:
+	 * address error response (default), or read-as-zero/write-ignored
+	 */
+	enum HolePolicy {
+		HOLE_ADDRESS_ERROR = 0, HOLE_RAZ_WI = 1
+	};
+
+	/**
+	 * Deferral of post-write notifications of transport writes: none
+	 * (default), to the end of each transaction, or to the end of the delta
+	 * cycle of the first write
+	 */
+	enum WriteCoalescing {
+		COALESCE_NONE = 0, COALESCE_TRANSACTION = 1, COALESCE_DELTA_CYCLE = 2
+	};
+
+	/**
+	 * AddressSpace class
+	 *
+	 * Additional named target socket decoding its own register file.
+	 * Registers of the module can be inserted in several address spaces, at
+	 * different addresses: register state is shared and each address space
+	 * decodes through its own cache and access latencies. Address spaces
+	 * serve blocking and debug transport; DMI and non-blocking transport are
+	 * served on memMapSocket only.
+	 */
+	class AddressSpace {
+	public:
+		/**
+		 * AddressSpace constructor
+		 * @param ownerIn Module serving accesses
+		 * @param nameIn Address space name
+		 * @param alignment Alignment value of register file in bytes
+		 */
+		AddressSpace(RegModule &ownerIn, const ::std::string &nameIn,
+				const ::std::size_t &alignment);
+
+		AddressSpace(const AddressSpace &) = delete;
+		AddressSpace& operator=(const AddressSpace &) = delete;
+
+		/**
+		 * Get address space name
+		 * @return Name
+		 */
+		const ::std::string& getName() const;
+
+		/**
+		 * Get register file decoded by address space
+		 * @return Register file
+		 */
+		::hv::reg::RegisterFile& getRegisterFile();
+
+		/**
+		 * Get decoder of address space, to set its access latencies
+		 * @return Decoder
+		 */
+		::hv::reg::AddressDecoder& getDecoder();
+
+		mem_map_socket_type socket;
+
+	protected:
+		void bTransportCb(mem_access_payload_type& txn, ::sc_core::sc_time& delay);
+
+		unsigned int transportDbgCb(mem_access_payload_type& txn);
+
+		RegModule &owner;
+
+		::std::string name;
+
+		::hv::reg::RegisterFile regFile;
+
+		::hv::reg::AddressDecoder decoder;
+	};
+
 	/**
 	 * RegModule constructor with name and optional alignment specification
 	 * @param name Name of RegModule
@@ -75,6 +198,23 @@ public:
 	 */
 	bool addRegisterFile(::hv::reg::RegisterFile& src);
 
+	/**
+	 * Add address region (register array, memory) to specified address
+	 * @param address Insertion address
+	 * @param src Region to insert
+	 * @return true if success, false else
+	 */
+	bool addRegion(::hv::common::hvaddr_t address,
+			::hv::reg::AddressRegion& src);
+
+	/**
+	 * Add address region with no specified address
+	 * Region is inserted following alignment rules of main register file.
+	 * @param src Region to insert
+	 * @return true if success, false else
+	 */
+	bool addRegion(::hv::reg::AddressRegion& src);
+
 	/**
 	 * Add RegModule to specified address
 	 * This method is equivalent to inserting src's main register file to
@@ -101,13 +241,508 @@ public:
 	 */
 	::std::string getInfo() const;
 
-	::hv::communication::tlm2::protocols::memorymapped::MemoryMappedSimpleTargetSocket<BUSWIDTH, ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedProtocolTypes, 0> memMapSocket;
+	/**
+	 * Export main register file values to a POSIX shared-memory segment
+	 *
+	 * Registers accessed through memMapSocket or address space sockets are
+	 * republished after each access.
+	 * Values modified by model code are republished by publishSharedMemory().
+	 * Exported layout is the one of the main register file when this method is called.
+	 * @param segmentName POSIX shared-memory object name (e.g. "/myModuleRegs")
+	 * @param replace Unlink and recreate an existing segment if true (see
+	 * RegisterFileSharedMemory::open())
+	 * @return true if success, false else
+	 */
+	bool exportToSharedMemory(const ::std::string &segmentName, const bool &replace = false);
+
+	/**
+	 * Publish all modified register values to shared-memory segment
+	 * @return Number of registers published
+	 */
+	::std::size_t publishSharedMemory();
+
+	/**
+	 * Enable access statistics on main register file
+	 */
+	void enableAccessStatistics();
+
+	/**
+	 * Get a table of most accessed registers
+	 * @param n Maximum number of registers to display
+	 * @return Information string
+	 */
+	::std::string getAccessStatisticsReport(const ::std::size_t &n = 20u) const;
+
+	/**
+	 * Export access statistics as CCI parameters
+	 *
+	 * For each counted register at address A, parameters stats_A_reads,
+	 * stats_A_writes, stats_A_vetoes and stats_A_bytes are created on first
+	 * export and updated on each call.
+	 */
+	void exportAccessStatistics();
+
+	/**
+	 * Record transactions received on memMapSocket
+	 *
+	 * One record is appended per transaction, whatever the number of registers
+	 * it spans. Register-level accesses can be recorded as well with
+	 * getMainRegFile().setTraceRecorder(). Module does not own the recorder.
+	 * @param recorder Trace recorder, nullptr to stop recording
+	 */
+	void setTraceRecorder(::hv::reg::AccessTraceRecorder *recorder);
+
+	/**
+	 * Set behavior of accesses to unmapped addresses
+	 *
+	 * With HOLE_RAZ_WI, holes are skipped by alignment steps (1 byte if
+	 * main register file has no alignment).
+	 * @param policy Hole policy
+	 */
+	void setHolePolicy(const HolePolicy &policy);
+
+	/**
+	 * Get behavior of accesses to unmapped addresses
+	 * @return Hole policy
+	 */
+	HolePolicy getHolePolicy() const;
+
+	/**
+	 * Add an address space with its own target socket
+	 *
+	 * Must be called during elaboration, e.g. in derived module constructor.
+	 * Registers are then inserted with getRegisterFile() of returned address space.
+	 * @param name Address space name, unique in module
+	 * @param alignment Alignment value of address space register file in bytes
+	 * @return Created address space
+	 */
+	AddressSpace& addAddressSpace(const ::std::string &name,
+			const ::std::size_t &alignment = 0);
+
+	/**
+	 * Get an address space by name
+	 * @param name Address space name
+	 * @return Address space
+	 */
+	AddressSpace& getAddressSpace(const ::std::string &name);
+
+	/**
+	 * Check if an address space exists
+	 * @param name Address space name
+	 * @return true if address space exists, false else
+	 */
+	bool hasAddressSpace(const ::std::string &name) const;
+
+	/**
+	 * Set latency of transport accesses to registers with no more specific latency
+	 *
+	 * Latencies are added to the annotated delay of transactions, once per
+	 * register accessed, without calling wait(): initiators using temporal
+	 * decoupling keep running ahead until their quantum is over.
+	 * @param read Read latency
+	 * @param write Write latency
+	 */
+	void setAccessLatency(const ::sc_core::sc_time &read,
+			const ::sc_core::sc_time &write);
+
+	/**
+	 * Set latency of transport accesses to registers starting in an address range
+	 *
+	 * When ranges overlap, the latest one applies. Register latencies take
+	 * precedence over range latencies.
+	 * @param start Range start address
+	 * @param end Range end address (included)
+	 * @param read Read latency
+	 * @param write Write latency
+	 */
+	void setRangeAccessLatency(const ::hv::common::hvaddr_t &start,
+			const ::hv::common::hvaddr_t &end, const ::sc_core::sc_time &read,
+			const ::sc_core::sc_time &write);
+
+	/**
+	 * Set latency of transport accesses to register starting at an address
+	 * @param address Register address
+	 * @param read Read latency
+	 * @param write Write latency
+	 */
+	void setRegisterAccessLatency(const ::hv::common::hvaddr_t &address,
+			const ::sc_core::sc_time &read, const ::sc_core::sc_time &write);
+
+	/**
+	 * Remove all access latencies
+	 */
+	void clearAccessLatencies();
+
+	/**
+	 * Get latency of transport accesses to an address
+	 * @param address Register address
+	 * @return Latency of register, else of latest range including address, else default latency
+	 */
+	const ::hv::reg::AccessLatency& getAccessLatency(
+			const ::hv::common::hvaddr_t &address) const;
+
+	/**
+	 * Set function giving attributes of transactions (initiator ID, privileged,
+	 * secure) checked against access rules of register files
+	 *
+	 * Function is only called for accesses to addresses covered by a rule.
+	 * Without function, transactions have default AccessAttributes. Denied
+	 * accesses get a generic error response and are not performed. Debug
+	 * transport is not checked.
+	 * @param extractor Attributes extraction function
+	 */
+	void setAccessAttributesExtractor(
+			const access_attributes_extractor_type &extractor);
+
+	/**
+	 * Enable or disable synchronization on quantum overrun (disabled by default)
+	 *
+	 * When enabled, a blocking transport whose annotated delay reaches the
+	 * global quantum (tlm::tlm_global_quantum) waits for this delay and
+	 * returns a zero delay, as a quantum keeper would. Blocking transport
+	 * must then be called from a thread.
+	 * @param enabled true to synchronize, false to only annotate
+	 */
+	void enableQuantumSync(const bool &enabled = true);
+
+	/**
+	 * Check if synchronization on quantum overrun is enabled
+	 * @return true if enabled, false else
+	 */
+	bool isQuantumSyncEnabled() const;
+
+	/**
+	 * Set deferral of post-write notifications of transport writes
+	 *
+	 * Module coalescer is attached to registers of main register file and
+	 * address spaces: each register written by a burst, or by all
+	 * transactions of a delta cycle, is notified once with its value before
+	 * first write as old value. Writes out of transport are deferred as well
+	 * while a batch is open.
+	 * @param mode Coalescing mode
+	 */
+	void setWriteCoalescing(const WriteCoalescing &mode);
+
+	/**
+	 * Get deferral of post-write notifications of transport writes
+	 * @return Coalescing mode
+	 */
+	WriteCoalescing getWriteCoalescing() const;
+
+	/**
+	 * Get post-write coalescer of module, e.g. to open batches from model code
+	 * @return Post-write coalescer
+	 */
+	::hv::reg::PostWriteCoalescer& getWriteCoalescer();
+
+	/**
+	 * Get local time of transport access being served
+	 *
+	 * Register callbacks should use this time rather than sc_time_stamp():
+	 * with temporal decoupling, it includes the delay annotated by the
+	 * initiator and latencies of registers previously accessed by the same
+	 * transaction.
+	 * @return Simulation time plus annotated delay, simulation time out of transport
+	 */
+	::sc_core::sc_time getAccessTime() const;
+
+	/**
+	 * Enable or disable DMI on memMapSocket (enabled by default)
+	 *
+	 * Read-only DMI pointers are granted into an image of register values,
+	 * for ranges of contiguous registers without side effects on read: no
+	 * callbacks, full read mask, no access statistics and no trace recording.
+	 * Writes still go through b_transport and update the image.
+	 * Regions giving direct memory pointers (e.g. SparseMemoryRegion) are
+	 * granted read/write DMI on their own storage, one page at a time,
+	 * unless access rules cover them.
+	 * Granted ranges are invalidated when a side effect is added to one of
+	 * their registers. Images follow every register modifier, including
+	 * Register::select() and Register::selectField() handles. Model code
+	 * modifying a register through operator ()() or operator [] must call
+	 * Register::notifyValueChange().
+	 * Mirrored registers and regions are detached from the module when it is
+	 * destroyed, and can outlive it.
+	 * @param enabled true to grant DMI pointers, false to deny them
+	 */
+	void enableDirectMemoryAccess(const bool &enabled = true);
+
+	/**
+	 * Check if DMI is enabled
+	 * @return true if DMI pointers are granted, false else
+	 */
+	bool isDirectMemoryAccessEnabled() const;
+
+	/**
+	 * Get number of transport decodes served by decode cache (including unmapped addresses)
+	 * @return Number of decode cache hits
+	 */
+	::hv::common::hvuint64_t getDecodeCacheHits() const;
+
+	/**
+	 * Get number of transport decodes looked up in main register file
+	 * @return Number of decode cache misses
+	 */
+	::hv::common::hvuint64_t getDecodeCacheMisses() const;
+
+	void onValueChange(const ::hv::reg::Register &reg) override;
+
+	void onAccessPolicyChange(const ::hv::reg::Register &reg) override;
+
+	void onDirectMemoryInvalidation(const ::hv::reg::AddressRegion &region,
+			const ::hv::common::hvaddr_t &startOffset,
+			const ::hv::common::hvaddr_t &endOffset) override;
+
+	void onRegisterDestruction(const ::hv::reg::Register &reg) override;
+
+	void onRegionDestruction(const ::hv::reg::AddressRegion &region) override;
+
+	mem_map_socket_type memMapSocket;
 
 protected:
 	void bTransportCb(mem_access_payload_type& txn, ::sc_core::sc_time& delay);
 
+	/**
+	 * Blocking transport in an address space
+	 * @param decoder Decoder of address space
+	 * @param txn Transaction
+	 * @param delay Transaction annotated delay
+	 */
+	void blockingTransport(::hv::reg::AddressDecoder &decoder,
+			mem_access_payload_type& txn, ::sc_core::sc_time& delay);
+
+	/**
+	 * Generic blocking transport path, burst accesses on subsequent registers
+	 * @param decoder Decoder of address space
+	 * @param txn Transaction
+	 * @param delay Transaction annotated delay
+	 */
+	void transport(::hv::reg::AddressDecoder &decoder,
+			mem_access_payload_type& txn, ::sc_core::sc_time& delay);
+
+	/**
+	 * Non-blocking transport (base protocol phases)
+	 *
+	 * BEGIN_REQ is accepted at once (END_REQ returned with TLM_UPDATED) so that
+	 * initiators can pipeline requests. Requests are served in order by
+	 * nbTransportThread(), which sends BEGIN_RESP annotated with the access
+	 * delay. Transactions must stay valid until END_RESP.
+	 * @param txn Transaction
+	 * @param phase Transaction phase
+	 * @param delay Transaction annotated delay
+	 * @return Synchronization status
+	 */
+	::tlm::tlm_sync_enum nbTransportFwCb(mem_access_payload_type& txn,
+			::tlm::tlm_phase& phase, ::sc_core::sc_time& delay);
+
+	/**
+	 * Process serving queued non-blocking requests, one response in flight at a time
+	 */
+	void nbTransportThread();
+
+	/**
+	 * Process closing post-write batches at end of delta cycles
+	 */
+	void writeCoalescingThread();
+
+	/**
+	 * Serve transaction with a single word copy if possible
+	 *
+	 * Applies to transactions of one bus word, aligned on bus width, to a
+	 * register of bus width.
+	 * @param decoder Decoder of address space
+	 * @param txn Transaction
+	 * @param delay Transaction annotated delay
+	 * @return true if transaction was served, false if generic path must be used
+	 */
+	bool wordTransport(::hv::reg::AddressDecoder &decoder,
+			mem_access_payload_type& txn, ::sc_core::sc_time& delay);
+
+	template<typename WORD> bool wordTransport(
+			::hv::reg::AddressDecoder &decoder, mem_access_payload_type& txn,
+			::sc_core::sc_time& delay, WORD*);
+
+	bool wordTransport(::hv::reg::AddressDecoder &decoder,
+			mem_access_payload_type& txn, ::sc_core::sc_time& delay, void*);
+
+	/**
+	 * Check a transaction against permission of an address
+	 * @param txn Transaction
+	 * @param permission Access permission of address
+	 * @return true if access is allowed, false else
+	 */
+	bool isAccessAllowed(const mem_access_payload_type& txn,
+			const ::hv::reg::AccessPermission &permission) const;
+
+	/**
+	 * Republish a register accessed through transport to shared-memory segment
+	 *
+	 * Register is found by identity, so that accesses of any address space
+	 * only publish the accessed register.
+	 * @param reg Accessed register
+	 */
+	void publishTransportAccess(const ::hv::reg::Register &reg);
+
+	/**
+	 * Append a transaction to trace if a recorder is attached
+	 * @param txn Transaction
+	 * @param delay Transaction annotated delay
+	 * @param status Transaction status
+	 */
+	void traceTransaction(const mem_access_payload_type& txn,
+			const ::sc_core::sc_time& delay,
+			const ::hv::reg::AccessTraceRecord::Status &status);
+
+	bool getDirectMemPtrCb(mem_access_payload_type& txn, ::tlm::tlm_dmi& dmi);
+
+	/**
+	 * Debug transport: burst access on register storage without side effects
+	 *
+	 * Callbacks, masks, statistics and trace are bypassed. Padding bytes
+	 * between registers are read as zeros. Unless hole policy is
+	 * HOLE_RAZ_WI, transfer stops at the first address where no register starts.
+	 * @param txn Transaction
+	 * @return Number of bytes transferred
+	 */
+	unsigned int transportDbgCb(mem_access_payload_type& txn);
+
+	/**
+	 * Debug transport in an address space (see transportDbgCb())
+	 * @param decoder Decoder of address space
+	 * @param txn Transaction
+	 * @return Number of bytes transferred
+	 */
+	unsigned int debugTransport(::hv::reg::AddressDecoder &decoder,
+			mem_access_payload_type& txn);
+
+	/**
+	 * Build DMI images from main register file layout
+	 *
+	 * Previously granted pointers are invalidated.
+	 */
+	void buildDirectMemoryImages();
+
+	/**
+	 * Grant DMI pointer on storage of a region
+	 * @param base Region address
+	 * @param region Region
+	 * @param address Requested address
+	 * @param dmi DMI descriptor
+	 * @return true if pointer was granted, false else
+	 */
+	bool getRegionDirectMemPtr(const ::hv::common::hvaddr_t &base,
+			::hv::reg::AddressRegion &region,
+			const ::hv::common::hvaddr_t &address, ::tlm::tlm_dmi& dmi);
+
+	/**
+	 * Detach module from registers mirrored in DMI images
+	 */
+	void detachDirectMemoryImages();
+
+	/**
+	 * Check if a register can be read through DMI
+	 * @param reg Register
+	 * @return true if register has no side effect on read, false else
+	 */
+	bool isDirectMemoryEligible(const ::hv::reg::Register &reg) const;
+
+	/**
+	 * Invalidate all granted DMI pointers
+	 */
+	void invalidateDirectMemory();
+
 	::hv::reg::RegisterFile mainRegisterFile;
 
+	::hv::reg::RegisterFileSharedMemory sharedMemory;
+
+	::hv::reg::AccessTraceRecorder *traceRecorder;
+
+	/**
+	 * Decoder of main register file, with its access latencies
+	 */
+	::hv::reg::AddressDecoder mainDecoder;
+
+	/**
+	 * Additional address spaces, in order of creation
+	 */
+	::std::vector<::std::unique_ptr<AddressSpace> > addressSpaces;
+
+	HolePolicy holePolicy;
+
+	access_attributes_extractor_type accessAttributesExtractor;
+
+	bool quantumSync;
+
+	/**
+	 * Annotated delay of transport access being served, nullptr out of transport
+	 */
+	const ::sc_core::sc_time *accessDelay;
+
+	/**
+	 * DMI images of contiguous registers, by start address
+	 */
+	::std::map<::hv::common::hvaddr_t, ::std::vector<::hv::common::hvuint8_t> > dmiImages;
+
+	/**
+	 * Map register/address of registers mirrored in DMI images
+	 */
+	::std::unordered_map<const ::hv::reg::Register *, ::hv::common::hvaddr_t> dmiAddresses;
+
+	/**
+	 * Regions attached to module by a DMI grant
+	 */
+	::std::set<const ::hv::reg::AddressRegion *> dmiRegions;
+
+	/**
+	 * Main register file revision when DMI images were built
+	 */
+	::hv::common::hvuint64_t dmiRevision;
+
+	bool dmiEnabled;
+
+	/**
+	 * true if a DMI pointer was granted since last invalidation
+	 */
+	bool dmiGranted;
+
+	/**
+	 * Non-blocking request waiting to be served
+	 */
+	struct NbRequest {
+		mem_access_payload_type *txn;
+
+		/**
+		 * Request time (time of BEGIN_REQ plus its annotated delay)
+		 */
+		::sc_core::sc_time time;
+	};
+
+	::std::deque<NbRequest> nbRequests;
+
+	::sc_core::sc_event nbRequestEvent, nbEndResponseEvent;
+
+	/**
+	 * true while waiting for END_RESP of last response
+	 */
+	bool nbResponsePending;
+
+	WriteCoalescing writeCoalescing;
+
+	::hv::reg::PostWriteCoalescer writeCoalescer;
+
+	/**
+	 * true while a batch is open until end of delta cycle
+	 */
+	bool deltaBatchOpen;
+
+	::sc_core::sc_event writeCoalescingEvent;
+
+	/**
+	 * Access statistics parameters (reads, writes, vetoes, bytes) per register address
+	 */
+	::std::map<::hv::common::hvaddr_t,
+			::std::vector<::std::unique_ptr<::hv::cfg::Param<::hv::common::hvuint64_t> > > > statisticsParams;
+
 public:
     ::hv::cfg::Param<bool> enable;
     ::hv::cfg::Param<bool> reset;
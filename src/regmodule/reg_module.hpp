@@ -15,11 +15,64 @@ RegModule<BUSWIDTH>::RegModule(::hv::module::ModuleName name_, const std::size_t
     : ::hv::module::Module(name_), memMapSocket("MemMapSocket"),
       mainRegisterFile(name_ + "_mainRegFile", "Main Register File of " + std::string(name_),
                        alignment),
+      sharedMemory(mainRegisterFile), traceRecorder(nullptr), mainDecoder(mainRegisterFile),
+      holePolicy(HOLE_ADDRESS_ERROR), quantumSync(false), accessDelay(nullptr),
+      dmiRevision(~::hv::common::hvuint64_t(0u)), dmiEnabled(true), dmiGranted(false),
+      nbResponsePending(false), writeCoalescing(COALESCE_NONE), deltaBatchOpen(false),
       enable("enable", false), reset("reset", false) {
     memMapSocket.registerBTransport(this, &RegModule<BUSWIDTH>::bTransportCb);
+    memMapSocket.registerGetDirectMemPtr(this, &RegModule<BUSWIDTH>::getDirectMemPtrCb);
+    memMapSocket.registerTransportDbg(this, &RegModule<BUSWIDTH>::transportDbgCb);
+    memMapSocket.registerNBTransportFw(this, &RegModule<BUSWIDTH>::nbTransportFwCb);
+    SC_THREAD(nbTransportThread);
+    SC_THREAD(writeCoalescingThread);
 }
 
 template <unsigned int BUSWIDTH> RegModule<BUSWIDTH>::~RegModule() {
+    // Registers and regions destroyed before module have already been forgotten
+    detachDirectMemoryImages();
+    const RegisterFile::armap_t &regions = mainRegisterFile.getAllRegions();
+    for (RegisterFile::armap_t::const_iterator it = regions.cbegin(); it != regions.cend(); ++it) {
+        if (dmiRegions.find(&it->second) != dmiRegions.cend()) {
+            it->second.setListener(nullptr);
+        }
+    }
+}
+
+template <unsigned int BUSWIDTH>
+RegModule<BUSWIDTH>::AddressSpace::AddressSpace(RegModule &ownerIn, const ::std::string &nameIn,
+                                                const ::std::size_t &alignment)
+    : socket((nameIn + "Socket").c_str()), owner(ownerIn), name(nameIn),
+      regFile(nameIn + "_regFile", "Register File of address space " + nameIn, alignment),
+      decoder(regFile) {
+    socket.registerBTransport(this, &AddressSpace::bTransportCb);
+    socket.registerTransportDbg(this, &AddressSpace::transportDbgCb);
+}
+
+template <unsigned int BUSWIDTH>
+const ::std::string &RegModule<BUSWIDTH>::AddressSpace::getName() const {
+    return name;
+}
+
+template <unsigned int BUSWIDTH>
+RegisterFile &RegModule<BUSWIDTH>::AddressSpace::getRegisterFile() {
+    return regFile;
+}
+
+template <unsigned int BUSWIDTH>
+AddressDecoder &RegModule<BUSWIDTH>::AddressSpace::getDecoder() {
+    return decoder;
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::AddressSpace::bTransportCb(mem_access_payload_type &txn,
+                                                     ::sc_core::sc_time &delay) {
+    owner.blockingTransport(decoder, txn, delay);
+}
+
+template <unsigned int BUSWIDTH>
+unsigned int RegModule<BUSWIDTH>::AddressSpace::transportDbgCb(mem_access_payload_type &txn) {
+    return owner.debugTransport(decoder, txn);
 }
 
 template <unsigned int BUSWIDTH> RegisterFile &RegModule<BUSWIDTH>::getMainRegFile() {
@@ -44,6 +97,15 @@ template <unsigned int BUSWIDTH> bool RegModule<BUSWIDTH>::addRegisterFile(Regis
     return mainRegisterFile.addRegisterFile(src);
 }
 
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::addRegion(::hv::common::hvaddr_t address, AddressRegion &src) {
+    return mainRegisterFile.addRegion(address, src);
+}
+
+template <unsigned int BUSWIDTH> bool RegModule<BUSWIDTH>::addRegion(AddressRegion &src) {
+    return mainRegisterFile.addRegion(src);
+}
+
 template <unsigned int BUSWIDTH>
 bool RegModule<BUSWIDTH>::addRegModule(::hv::common::hvaddr_t address, RegModule &src) {
     return mainRegisterFile.addRegisterFile(address, src.mainRegisterFile);
@@ -57,43 +119,800 @@ template <unsigned int BUSWIDTH> std::string RegModule<BUSWIDTH>::getInfo() cons
     return mainRegisterFile.getRecursiveInfo();
 }
 
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::exportToSharedMemory(const std::string &segmentName,
+                                               const bool &replace) {
+    return sharedMemory.open(segmentName, replace);
+}
+
+template <unsigned int BUSWIDTH> std::size_t RegModule<BUSWIDTH>::publishSharedMemory() {
+    return sharedMemory.publish();
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::enableAccessStatistics() {
+    mainRegisterFile.enableAccessStatistics();
+}
+
+template <unsigned int BUSWIDTH>
+std::string RegModule<BUSWIDTH>::getAccessStatisticsReport(const std::size_t &n) const {
+    return mainRegisterFile.getAccessStatisticsReport(n);
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::exportAccessStatistics() {
+    typedef ::hv::cfg::Param<::hv::common::hvuint64_t> stat_param_t;
+    const RegisterFile::rmap_t &regs = mainRegisterFile.getAllRegisters();
+    for (RegisterFile::rmap_t::const_iterator it = regs.cbegin(); it != regs.cend(); ++it) {
+        const RegisterAccessCounters *counters = it->second.getAccessCounters();
+        if (counters == nullptr) {
+            continue;
+        }
+        ::std::vector<::std::unique_ptr<stat_param_t>> &params = statisticsParams[it->first];
+        if (params.empty()) {
+            ::std::stringstream prefix;
+            prefix << "stats_0x" << ::std::hex << ::std::uppercase << it->first << "_";
+            params.emplace_back(new stat_param_t(prefix.str() + "reads", 0u));
+            params.emplace_back(new stat_param_t(prefix.str() + "writes", 0u));
+            params.emplace_back(new stat_param_t(prefix.str() + "vetoes", 0u));
+            params.emplace_back(new stat_param_t(prefix.str() + "bytes", 0u));
+        }
+        *params[0] = counters->reads;
+        *params[1] = counters->writes;
+        *params[2] = counters->readVetoes + counters->writeVetoes;
+        *params[3] = counters->bytesRead + counters->bytesWritten;
+    }
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::setTraceRecorder(AccessTraceRecorder *recorder) {
+    // Transactions served through DMI could not be recorded
+    if (recorder != nullptr) {
+        invalidateDirectMemory();
+    }
+    traceRecorder = recorder;
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::setHolePolicy(const HolePolicy &policy) {
+    holePolicy = policy;
+}
+
+template <unsigned int BUSWIDTH>
+typename RegModule<BUSWIDTH>::HolePolicy RegModule<BUSWIDTH>::getHolePolicy() const {
+    return holePolicy;
+}
+
+template <unsigned int BUSWIDTH>
+typename RegModule<BUSWIDTH>::AddressSpace &
+RegModule<BUSWIDTH>::addAddressSpace(const ::std::string &name, const ::std::size_t &alignment) {
+    if (hasAddressSpace(name)) {
+        HV_ERR("Address space " << name << " already exists in " << this->name())
+        exit(EXIT_FAILURE);
+    }
+    addressSpaces.emplace_back(new AddressSpace(*this, name, alignment));
+    if (writeCoalescing != COALESCE_NONE) {
+        addressSpaces.back()->getRegisterFile().setPostWriteCoalescer(&writeCoalescer);
+    }
+    return *addressSpaces.back();
+}
+
+template <unsigned int BUSWIDTH>
+typename RegModule<BUSWIDTH>::AddressSpace &
+RegModule<BUSWIDTH>::getAddressSpace(const ::std::string &name) {
+    for (auto &space : addressSpaces) {
+        if (space->getName() == name) {
+            return *space;
+        }
+    }
+    HV_ERR("No address space " << name << " in " << this->name())
+    exit(EXIT_FAILURE);
+}
+
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::hasAddressSpace(const ::std::string &name) const {
+    for (auto &space : addressSpaces) {
+        if (space->getName() == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::setAccessLatency(const ::sc_core::sc_time &read,
+                                           const ::sc_core::sc_time &write) {
+    mainDecoder.setAccessLatency(read, write);
+    // DMI read latency is the one of granted registers
+    invalidateDirectMemory();
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::setRangeAccessLatency(const ::hv::common::hvaddr_t &start,
+                                                const ::hv::common::hvaddr_t &end,
+                                                const ::sc_core::sc_time &read,
+                                                const ::sc_core::sc_time &write) {
+    mainDecoder.setRangeAccessLatency(start, end, read, write);
+    invalidateDirectMemory();
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::setRegisterAccessLatency(const ::hv::common::hvaddr_t &address,
+                                                   const ::sc_core::sc_time &read,
+                                                   const ::sc_core::sc_time &write) {
+    mainDecoder.setRegisterAccessLatency(address, read, write);
+    invalidateDirectMemory();
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::clearAccessLatencies() {
+    mainDecoder.clearAccessLatencies();
+    invalidateDirectMemory();
+}
+
+template <unsigned int BUSWIDTH>
+const AccessLatency &
+RegModule<BUSWIDTH>::getAccessLatency(const ::hv::common::hvaddr_t &address) const {
+    return mainDecoder.getAccessLatency(address);
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::setAccessAttributesExtractor(
+    const access_attributes_extractor_type &extractor) {
+    accessAttributesExtractor = extractor;
+}
+
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::isAccessAllowed(const mem_access_payload_type &txn,
+                                          const AccessPermission &permission) const {
+    if (permission.isUnrestricted()) {
+        return true;
+    }
+    const AccessAttributes attributes(accessAttributesExtractor ? accessAttributesExtractor(txn)
+                                                                : AccessAttributes());
+    return permission.allows(
+        attributes, txn.getCommand() ==
+                        ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_READ_COMMAND);
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::enableQuantumSync(const bool &enabled) {
+    quantumSync = enabled;
+}
+
+template <unsigned int BUSWIDTH> bool RegModule<BUSWIDTH>::isQuantumSyncEnabled() const {
+    return quantumSync;
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::setWriteCoalescing(const WriteCoalescing &mode) {
+    if (deltaBatchOpen) {
+        deltaBatchOpen = false;
+        writeCoalescer.endBatch();
+    }
+    writeCoalescing = mode;
+    PostWriteCoalescer *coalescer(mode == COALESCE_NONE ? nullptr : &writeCoalescer);
+    mainRegisterFile.setPostWriteCoalescer(coalescer);
+    for (auto &space : addressSpaces) {
+        space->getRegisterFile().setPostWriteCoalescer(coalescer);
+    }
+}
+
+template <unsigned int BUSWIDTH>
+typename RegModule<BUSWIDTH>::WriteCoalescing RegModule<BUSWIDTH>::getWriteCoalescing() const {
+    return writeCoalescing;
+}
+
+template <unsigned int BUSWIDTH> PostWriteCoalescer &RegModule<BUSWIDTH>::getWriteCoalescer() {
+    return writeCoalescer;
+}
+
+template <unsigned int BUSWIDTH> ::sc_core::sc_time RegModule<BUSWIDTH>::getAccessTime() const {
+    if (accessDelay == nullptr) {
+        return ::sc_core::sc_time_stamp();
+    }
+    return ::sc_core::sc_time_stamp() + *accessDelay;
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::enableDirectMemoryAccess(const bool &enabled) {
+    if (!enabled) {
+        invalidateDirectMemory();
+    }
+    dmiEnabled = enabled;
+}
+
+template <unsigned int BUSWIDTH> bool RegModule<BUSWIDTH>::isDirectMemoryAccessEnabled() const {
+    return dmiEnabled;
+}
+
+template <unsigned int BUSWIDTH>
+::hv::common::hvuint64_t RegModule<BUSWIDTH>::getDecodeCacheHits() const {
+    return mainDecoder.getHits();
+}
+
+template <unsigned int BUSWIDTH>
+::hv::common::hvuint64_t RegModule<BUSWIDTH>::getDecodeCacheMisses() const {
+    return mainDecoder.getMisses();
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::onValueChange(const Register &reg) {
+    auto it = dmiAddresses.find(&reg);
+    if (it == dmiAddresses.end()) {
+        return;
+    }
+    auto image = --dmiImages.upper_bound(it->second);
+    ::std::memcpy(image->second.data() + (it->second - image->first), reg.getDataAddress(),
+                  reg.getSizeInBytes());
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::onAccessPolicyChange(const Register &reg) {
+    if (!dmiGranted) {
+        return;
+    }
+    auto it = dmiAddresses.find(&reg);
+    if (it == dmiAddresses.end()) {
+        return;
+    }
+    memMapSocket->invalidate_direct_mem_ptr(it->second, it->second + reg.getSizeInBytes() - 1u);
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::onDirectMemoryInvalidation(const AddressRegion &region,
+                                                     const ::hv::common::hvaddr_t &startOffset,
+                                                     const ::hv::common::hvaddr_t &endOffset) {
+    if (!dmiGranted) {
+        return;
+    }
+    const RegisterFile::armap_t &regions = mainRegisterFile.getAllRegions();
+    for (RegisterFile::armap_t::const_iterator it = regions.cbegin(); it != regions.cend(); ++it) {
+        if (&it->second == &region) {
+            memMapSocket->invalidate_direct_mem_ptr(it->first + startOffset,
+                                                    it->first + endOffset);
+        }
+    }
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::onRegisterDestruction(const Register &reg) {
+    dmiAddresses.erase(&reg);
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::onRegionDestruction(const AddressRegion &region) {
+    dmiRegions.erase(&region);
+}
+
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::getDirectMemPtrCb(mem_access_payload_type &txn, ::tlm::tlm_dmi &dmi) {
+    const ::hv::common::hvaddr_t address(txn.getAddress());
+    dmi.set_start_address(address);
+    dmi.set_end_address(address);
+    if (!dmiEnabled || (traceRecorder != nullptr)) {
+        return false;
+    }
+    const RegisterFile::rmap_t &regs = mainRegisterFile.getAllRegisters();
+    if (dmiRevision != mainRegisterFile.getRevision()) {
+        buildDirectMemoryImages();
+    }
+
+    // Regions of banked windows are left out: bank switches do not invalidate DMI
+    const RegisterFile::armap_t &regions = mainRegisterFile.getAllRegions();
+    RegisterFile::armap_t::const_iterator itR = regions.upper_bound(address);
+    if (itR != regions.cbegin()) {
+        --itR;
+        if (address < itR->first + itR->second.getSizeInBytes()) {
+            return getRegionDirectMemPtr(itR->first, itR->second, address, dmi);
+        }
+    }
+
+    RegisterFile::rmap_t::const_iterator it = regs.upper_bound(address);
+    if (it == regs.cbegin()) {
+        return false;
+    }
+    --it;
+    ::hv::common::hvaddr_t start(it->first);
+    ::hv::common::hvaddr_t end(it->first + it->second.getSizeInBytes());
+    if (address >= end) {
+        return false;
+    }
+    dmi.set_start_address(start);
+    dmi.set_end_address(end - 1u);
+    if (!isDirectMemoryEligible(it->second)) {
+        return false;
+    }
+    const ::sc_core::sc_time readLatency(getAccessLatency(start).read);
+
+    // Extending granted range to adjacent eligible registers with same read latency
+    for (RegisterFile::rmap_t::const_iterator prev = it; prev != regs.cbegin();) {
+        --prev;
+        if ((prev->first + prev->second.getSizeInBytes() != start) ||
+            !isDirectMemoryEligible(prev->second) ||
+            (getAccessLatency(prev->first).read != readLatency)) {
+            break;
+        }
+        start = prev->first;
+    }
+    for (RegisterFile::rmap_t::const_iterator next = ::std::next(it);
+         (next != regs.cend()) && (next->first == end) && isDirectMemoryEligible(next->second) &&
+         (getAccessLatency(next->first).read == readLatency);
+         ++next) {
+        end += next->second.getSizeInBytes();
+    }
+
+    auto image = --dmiImages.upper_bound(start);
+    dmi.set_dmi_ptr(image->second.data() + (start - image->first));
+    dmi.set_start_address(start);
+    dmi.set_end_address(end - 1u);
+    dmi.set_granted_access(::tlm::tlm_dmi::DMI_ACCESS_READ);
+    dmi.set_read_latency(readLatency);
+    dmiGranted = true;
+    return true;
+}
+
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::getRegionDirectMemPtr(const ::hv::common::hvaddr_t &base,
+                                                AddressRegion &region,
+                                                const ::hv::common::hvaddr_t &address,
+                                                ::tlm::tlm_dmi &dmi) {
+    if ((region.getListener() != nullptr) && (region.getListener() != this)) {
+        return false;
+    }
+    // DMI accesses would bypass permission checks
+    if (mainRegisterFile.hasAccessRules(base, base + region.getSizeInBytes() - 1u)) {
+        return false;
+    }
+    ::hv::common::hvaddr_t startOffset(0u), endOffset(0u);
+    ::hv::common::hvuint8_t *ptr(region.getDirectMemPtr(address - base, startOffset, endOffset));
+    if (ptr == nullptr) {
+        return false;
+    }
+    region.setListener(this);
+    dmiRegions.insert(&region);
+    const AccessLatency &latency(getAccessLatency(address));
+    dmi.set_dmi_ptr(ptr);
+    dmi.set_start_address(base + startOffset);
+    dmi.set_end_address(base + endOffset);
+    dmi.set_granted_access(::tlm::tlm_dmi::DMI_ACCESS_READ_WRITE);
+    dmi.set_read_latency(latency.read);
+    dmi.set_write_latency(latency.write);
+    dmiGranted = true;
+    return true;
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::buildDirectMemoryImages() {
+    invalidateDirectMemory();
+    detachDirectMemoryImages();
+    dmiImages.clear();
+    const RegisterFile::rmap_t &regs = mainRegisterFile.getAllRegisters();
+    ::std::vector<::hv::common::hvuint8_t> *image(nullptr);
+    ::hv::common::hvaddr_t end(0u);
+    for (RegisterFile::rmap_t::const_iterator it = regs.cbegin(); it != regs.cend(); ++it) {
+        Register &reg(it->second);
+        // Registers already mirrored by another listener or overlapping previous one are
+        // left out
+        if ((reg.getListener() != nullptr) && (reg.getListener() != this)) {
+            continue;
+        }
+        if ((image == nullptr) || (it->first > end)) {
+            image = &dmiImages[it->first];
+        } else if (it->first < end) {
+            continue;
+        }
+        reg.setListener(this);
+        dmiAddresses[&reg] = it->first;
+        const ::hv::common::hvuint8_t *value =
+            static_cast<const ::hv::common::hvuint8_t *>(reg.getDataAddress());
+        image->insert(image->end(), value, value + reg.getSizeInBytes());
+        end = it->first + reg.getSizeInBytes();
+    }
+    dmiRevision = mainRegisterFile.getRevision();
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::detachDirectMemoryImages() {
+    const RegisterFile::rmap_t &regs = mainRegisterFile.getAllRegisters();
+    for (RegisterFile::rmap_t::const_iterator it = regs.cbegin(); it != regs.cend(); ++it) {
+        if (dmiAddresses.find(&it->second) != dmiAddresses.cend()) {
+            it->second.setListener(nullptr);
+        }
+    }
+    dmiAddresses.clear();
+}
+
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::isDirectMemoryEligible(const Register &reg) const {
+    if ((reg.getListener() != this) || (dmiAddresses.find(&reg) == dmiAddresses.cend())) {
+        return false;
+    }
+    if (!reg.isSideEffectFree()) {
+        return false;
+    }
+    // DMI reads would bypass permission checks and address-range callbacks
+    const ::hv::common::hvaddr_t address(dmiAddresses.find(&reg)->second);
+    if (!mainRegisterFile.getAccessPermission(address).isUnrestricted() ||
+        mainRegisterFile.hasRangeCallbacks(address, reg.getSizeInBytes())) {
+        return false;
+    }
+    const ::std::size_t size(reg.getSize());
+    return reg.getReadMask() == ::hv::common::BitVector(size, ~::hv::common::BitVector(size, 0u));
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::invalidateDirectMemory() {
+    if (!dmiGranted) {
+        return;
+    }
+    dmiGranted = false;
+    memMapSocket->invalidate_direct_mem_ptr(0u, ~::sc_dt::uint64(0u));
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::traceTransaction(const mem_access_payload_type &txn,
+                                           const ::sc_core::sc_time &delay,
+                                           const AccessTraceRecord::Status &status) {
+    if (traceRecorder == nullptr) {
+        return;
+    }
+    AccessTraceRecord::Command cmd(
+        txn.getCommand() ==
+                ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_READ_COMMAND
+            ? AccessTraceRecord::READ
+            : AccessTraceRecord::WRITE);
+    traceRecorder->record(AccessTraceRecorder::now() + delay.value(), txn.getAddress(),
+                          txn.getDataPtr(), txn.getDataLength(), cmd, status,
+                          AccessTraceRecord::TRANSPORT);
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::publishTransportAccess(const Register &reg) {
+    if (sharedMemory.isOpen()) {
+        sharedMemory.publish(reg);
+    }
+}
+
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::wordTransport(AddressDecoder &decoder, mem_access_payload_type &txn,
+                                        ::sc_core::sc_time &delay) {
+    return wordTransport(decoder, txn, delay, static_cast<bus_word_type *>(nullptr));
+}
+
+// Bus widths without native word type
+template <unsigned int BUSWIDTH>
+bool RegModule<BUSWIDTH>::wordTransport(AddressDecoder &, mem_access_payload_type &,
+                                        ::sc_core::sc_time &, void *) {
+    return false;
+}
+
+template <unsigned int BUSWIDTH>
+template <typename WORD>
+bool RegModule<BUSWIDTH>::wordTransport(AddressDecoder &decoder, mem_access_payload_type &txn,
+                                        ::sc_core::sc_time &delay, WORD *) {
+    const ::hv::common::hvaddr_t address(txn.getAddress());
+    if ((txn.getDataLength() != sizeof(WORD)) || (address & (sizeof(WORD) - 1u))) {
+        return false;
+    }
+    const AddressDecoder::Entry &entry(decoder.lookup(address));
+    Register *reg(entry.reg);
+    const AccessLatency *latency(entry.latency);
+    // Address-range callbacks are dispatched by generic path
+    if ((reg == nullptr) || (reg->getSizeInBytes() != sizeof(WORD)) || entry.rangeCallbacks) {
+        return false;
+    }
+    if (!isAccessAllowed(txn, entry.permission)) {
+        txn.setResponseStatus(
+            ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_GENERIC_ERROR_RESPONSE);
+        traceTransaction(txn, delay, AccessTraceRecord::DENIED);
+        return true;
+    }
+    bool success;
+    if (txn.getCommand() ==
+        ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_READ_COMMAND) {
+        success = reg->template readWord<WORD>(txn.getDataPtr());
+        delay += latency->read;
+    } else {
+        success = reg->template writeWord<WORD>(txn.getDataPtr());
+        delay += latency->write;
+    }
+    if (!success) {
+        txn.setResponseStatus(
+            ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_GENERIC_ERROR_RESPONSE);
+        traceTransaction(txn, delay, AccessTraceRecord::VETOED);
+        return true;
+    }
+    publishTransportAccess(*reg);
+    txn.setResponseStatus(
+        ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_OK_RESPONSE);
+    traceTransaction(txn, delay, AccessTraceRecord::OK);
+    return true;
+}
+
 template <unsigned int BUSWIDTH>
 void RegModule<BUSWIDTH>::bTransportCb(mem_access_payload_type &txn, ::sc_core::sc_time &delay) {
-    ::std::size_t alignment = mainRegisterFile.getAlignment();
+    blockingTransport(mainDecoder, txn, delay);
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::blockingTransport(AddressDecoder &decoder, mem_access_payload_type &txn,
+                                            ::sc_core::sc_time &delay) {
+    const ::sc_core::sc_time *previousDelay(accessDelay);
+    accessDelay = &delay;
+    if (writeCoalescing == COALESCE_TRANSACTION) {
+        writeCoalescer.beginBatch();
+    } else if ((writeCoalescing == COALESCE_DELTA_CYCLE) && !deltaBatchOpen) {
+        deltaBatchOpen = true;
+        writeCoalescer.beginBatch();
+        writeCoalescingEvent.notify(::sc_core::SC_ZERO_TIME);
+    }
+    if (!wordTransport(decoder, txn, delay)) {
+        transport(decoder, txn, delay);
+    }
+    // Notifications are delivered with access time of the transaction
+    if (writeCoalescing == COALESCE_TRANSACTION) {
+        writeCoalescer.endBatch();
+    }
+    accessDelay = previousDelay;
+    if (quantumSync && (delay != ::sc_core::SC_ZERO_TIME) &&
+        (delay >= ::tlm::tlm_global_quantum::instance().get())) {
+        ::sc_core::wait(delay);
+        delay = ::sc_core::SC_ZERO_TIME;
+    }
+}
+
+template <unsigned int BUSWIDTH>
+void RegModule<BUSWIDTH>::transport(AddressDecoder &decoder, mem_access_payload_type &txn,
+                                    ::sc_core::sc_time &delay) {
+    RegisterFile &regFile(decoder.getRegisterFile());
+    ::std::size_t alignment = regFile.getAlignment();
     ::hv::common::hvaddr_t destination = txn.getAddress();
-    ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedCommand cmd(txn.getCommand());
+    const bool isRead(txn.getCommand() ==
+                      ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_READ_COMMAND);
     std::size_t txnSize(txn.getDataLength());
     ::hv::common::hvuint8_t *dataTmp(txn.getDataPtr());
 
     // Transaction size can be larger than only one register
     // Therefore we concatenate the values of subsequent registers in our buffer
     while (txnSize) {
-        Register &regTmp(mainRegisterFile(destination));
-        ::std::size_t opSize(HV_MIN(txnSize, regTmp.getSizeInBytes()));
-        if (cmd == ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_READ_COMMAND) {
-            if (!regTmp.read(dataTmp, opSize)) {
+        const AddressDecoder::Entry &entry(decoder.lookup(destination));
+        Register *reg(entry.reg);
+        const AccessLatency *latency(entry.latency);
+        // Entry may be overwritten by accesses issued from callbacks
+        const bool rangeCallbacks(entry.rangeCallbacks);
+        AddressRegion *region(entry.region);
+        const ::hv::common::hvaddr_t regionOffset(entry.regionOffset);
+        if ((reg == nullptr) && (region != nullptr)) {
+            if (!isAccessAllowed(txn, entry.permission)) {
                 txn.setResponseStatus(::hv::communication::tlm2::protocols::memorymapped::
                                           MEM_MAP_GENERIC_ERROR_RESPONSE);
+                traceTransaction(txn, delay, AccessTraceRecord::DENIED);
                 return;
             }
-        } else {
-            if (!regTmp.write(dataTmp, opSize)) {
+            // Region accesses stop at region end
+            ::std::size_t opSize(HV_MIN(txnSize, region->getSizeInBytes() - regionOffset));
+            bool success;
+            if (isRead) {
+                success = region->read(regionOffset, dataTmp, opSize);
+                delay += latency->read;
+            } else {
+                success = region->write(regionOffset, dataTmp, opSize);
+                delay += latency->write;
+            }
+            if (!success) {
                 txn.setResponseStatus(::hv::communication::tlm2::protocols::memorymapped::
                                           MEM_MAP_GENERIC_ERROR_RESPONSE);
+                traceTransaction(txn, delay, AccessTraceRecord::VETOED);
                 return;
             }
+            txnSize -= opSize;
+            dataTmp += opSize;
+            destination += opSize;
+            continue;
         }
+        if (reg == nullptr) {
+            // Accesses starting in the middle of a register are never holes
+            if ((holePolicy != HOLE_RAZ_WI) || entry.insideRegister) {
+                txn.setResponseStatus(::hv::communication::tlm2::protocols::memorymapped::
+                                          MEM_MAP_ADDRESS_ERROR_RESPONSE);
+                traceTransaction(txn, delay, AccessTraceRecord::ADDRESS_ERROR);
+                return;
+            }
+            // Read as zero, write ignored, up to next aligned address where a
+            // register may start
+            ::std::size_t holeSize(1u);
+            if (alignment) {
+                holeSize = regFile.getNearestSuperiorAlignedAddress(destination + 1u, alignment) -
+                           destination;
+            }
+            holeSize = HV_MIN(txnSize, holeSize);
+            if (isRead) {
+                ::std::memset(dataTmp, 0, holeSize);
+                delay += latency->read;
+            } else {
+                delay += latency->write;
+            }
+            txnSize -= holeSize;
+            dataTmp += holeSize;
+            destination += holeSize;
+            continue;
+        }
+        if (!isAccessAllowed(txn, entry.permission)) {
+            txn.setResponseStatus(
+                ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_GENERIC_ERROR_RESPONSE);
+            traceTransaction(txn, delay, AccessTraceRecord::DENIED);
+            return;
+        }
+        Register &regTmp(*reg);
+        ::std::size_t opSize(HV_MIN(txnSize, regTmp.getSizeInBytes()));
+        if (rangeCallbacks &&
+            !regFile.dispatchRangeCallbacks(isRead ? RANGE_PRE_READ : RANGE_PRE_WRITE, destination,
+                                            regTmp, dataTmp, opSize)) {
+            txn.setResponseStatus(
+                ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_GENERIC_ERROR_RESPONSE);
+            traceTransaction(txn, delay, AccessTraceRecord::VETOED);
+            return;
+        }
+        bool success;
+        if (isRead) {
+            success = regTmp.read(dataTmp, opSize);
+            delay += latency->read;
+        } else {
+            success = regTmp.write(dataTmp, opSize);
+            delay += latency->write;
+        }
+        if (!success) {
+            txn.setResponseStatus(
+                ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_GENERIC_ERROR_RESPONSE);
+            traceTransaction(txn, delay, AccessTraceRecord::VETOED);
+            return;
+        }
+        if (rangeCallbacks) {
+            regFile.dispatchRangeCallbacks(isRead ? RANGE_POST_READ : RANGE_POST_WRITE, destination,
+                                           regTmp, dataTmp, opSize);
+        }
+        publishTransportAccess(regTmp);
         ::std::size_t offset(alignment);
         if (opSize > alignment) {
-            offset =
-                mainRegisterFile.getNearestSuperiorAlignedAddress(destination + opSize, alignment) -
-                destination;
+            offset = regFile.getNearestSuperiorAlignedAddress(destination + opSize, alignment) -
+                     destination;
+        }
+        // Padding between registers reads as zero
+        if (isRead && (HV_MIN(offset, txnSize) > opSize)) {
+            ::std::memset(dataTmp + opSize, 0, HV_MIN(offset, txnSize) - opSize);
         }
 
         txnSize -= offset < txnSize ? offset : txnSize;
         dataTmp += offset;
         destination += offset;
     }
+    txn.setResponseStatus(
+        ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_OK_RESPONSE);
+    traceTransaction(txn, delay, AccessTraceRecord::OK);
+}
+
+template <unsigned int BUSWIDTH>
+::tlm::tlm_sync_enum RegModule<BUSWIDTH>::nbTransportFwCb(mem_access_payload_type &txn,
+                                                          ::tlm::tlm_phase &phase,
+                                                          ::sc_core::sc_time &delay) {
+    if (phase == ::tlm::BEGIN_REQ) {
+        NbRequest req = {&txn, ::sc_core::sc_time_stamp() + delay};
+        nbRequests.push_back(req);
+        nbRequestEvent.notify(delay);
+        phase = ::tlm::END_REQ;
+        return ::tlm::TLM_UPDATED;
+    }
+    if (phase == ::tlm::END_RESP) {
+        nbResponsePending = false;
+        nbEndResponseEvent.notify(delay);
+        return ::tlm::TLM_COMPLETED;
+    }
+    HV_WARN("Unexpected phase on non-blocking transport of " << name())
+    return ::tlm::TLM_ACCEPTED;
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::nbTransportThread() {
+    while (true) {
+        while (nbRequests.empty()) {
+            ::sc_core::wait(nbRequestEvent);
+        }
+        NbRequest req(nbRequests.front());
+        nbRequests.pop_front();
+        if (req.time > ::sc_core::sc_time_stamp()) {
+            ::sc_core::wait(req.time - ::sc_core::sc_time_stamp());
+        }
+
+        // Same access path as blocking transport, the resulting delay
+        // annotates the response
+        ::sc_core::sc_time delay(::sc_core::SC_ZERO_TIME);
+        bTransportCb(*req.txn, delay);
+
+        ::tlm::tlm_phase phase(::tlm::BEGIN_RESP);
+        nbResponsePending = true;
+        ::tlm::tlm_sync_enum status(memMapSocket->nb_transport_bw(*req.txn, phase, delay));
+        if ((status == ::tlm::TLM_COMPLETED) ||
+            ((status == ::tlm::TLM_UPDATED) && (phase == ::tlm::END_RESP))) {
+            nbResponsePending = false;
+            ::sc_core::wait(delay);
+        }
+        while (nbResponsePending) {
+            ::sc_core::wait(nbEndResponseEvent);
+        }
+    }
+}
+
+template <unsigned int BUSWIDTH> void RegModule<BUSWIDTH>::writeCoalescingThread() {
+    while (true) {
+        ::sc_core::wait(writeCoalescingEvent);
+        if (deltaBatchOpen) {
+            deltaBatchOpen = false;
+            writeCoalescer.endBatch();
+        }
+    }
+}
+
+template <unsigned int BUSWIDTH>
+unsigned int RegModule<BUSWIDTH>::transportDbgCb(mem_access_payload_type &txn) {
+    return debugTransport(mainDecoder, txn);
+}
+
+template <unsigned int BUSWIDTH>
+unsigned int RegModule<BUSWIDTH>::debugTransport(AddressDecoder &decoder,
+                                                 mem_access_payload_type &txn) {
+    RegisterFile &regFile(decoder.getRegisterFile());
+    ::std::size_t alignment = regFile.getAlignment();
+    ::hv::common::hvaddr_t destination = txn.getAddress();
+    const bool isRead(txn.getCommand() ==
+                      ::hv::communication::tlm2::protocols::memorymapped::MEM_MAP_READ_COMMAND);
+    const ::std::size_t txnSize(txn.getDataLength());
+    ::hv::common::hvuint8_t *data(txn.getDataPtr());
+    ::std::size_t done(0u);
+
+    while (done < txnSize) {
+        const AddressDecoder::Entry &entry(decoder.lookup(destination));
+        Register *regTmp(entry.reg);
+        if ((regTmp == nullptr) && (entry.region != nullptr)) {
+            AddressRegion &region(*entry.region);
+            const ::hv::common::hvaddr_t regionOffset(entry.regionOffset);
+            ::std::size_t opSize(HV_MIN(txnSize - done, region.getSizeInBytes() - regionOffset));
+            if (isRead) {
+                region.debugRead(regionOffset, data + done, opSize);
+            } else {
+                region.debugWrite(regionOffset, data + done, opSize);
+            }
+            done += opSize;
+            destination += opSize;
+            continue;
+        }
+        if (regTmp == nullptr) {
+            if ((holePolicy != HOLE_RAZ_WI) || entry.insideRegister) {
+                break;
+            }
+            ::std::size_t holeSize(1u);
+            if (alignment) {
+                holeSize = regFile.getNearestSuperiorAlignedAddress(destination + 1u, alignment) -
+                           destination;
+            }
+            holeSize = HV_MIN(txnSize - done, holeSize);
+            if (isRead) {
+                ::std::memset(data + done, 0, holeSize);
+            }
+            done += holeSize;
+            destination += holeSize;
+            continue;
+        }
+        ::std::size_t opSize(HV_MIN(txnSize - done, regTmp->getSizeInBytes()));
+        if (isRead) {
+            regTmp->debugRead(data + done, opSize);
+        } else {
+            regTmp->debugWrite(data + done, opSize);
+            publishTransportAccess(*regTmp);
+        }
+        ::std::size_t offset(alignment);
+        if (opSize > alignment) {
+            offset = regFile.getNearestSuperiorAlignedAddress(destination + opSize, alignment) -
+                     destination;
+        }
+        offset = HV_MIN(offset, txnSize - done);
+        if (isRead && (offset > opSize)) {
+            ::std::memset(data + done + opSize, 0, offset - opSize);
+        }
+        done += offset;
+        destination += offset;
+    }
+    return static_cast<unsigned int>(done);
 }
 
 } // namespace reg
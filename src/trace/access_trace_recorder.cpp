@@ -0,0 +1,182 @@
+/**
+ * @file access_trace_recorder.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Binary register-access trace recorder
+ */
+
+#include <chrono>
+#include <cstring>
+#include <systemc>
+
+#include "access_trace_recorder.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+namespace {
+/**
+ * Maximum number of records written by one fwrite call
+ */
+const std::size_t flushChunk = 4096u;
+
+std::size_t roundUpPowerOf2(std::size_t val) {
+	std::size_t ret(1u);
+	while (ret < val) {
+		ret <<= 1;
+	}
+	return ret;
+}
+}
+
+static_assert(sizeof(AccessTraceRecord) == 32u,
+		"AccessTraceRecord must be 32 bytes long");
+
+const hvuint32_t AccessTraceRecorder::version;
+
+AccessTraceRecorder::AccessTraceRecorder(const std::size_t &capacityIn) :
+		capacity(roundUpPowerOf2(HV_MAX(capacityIn, std::size_t(2u)))), ring(
+				new AccessTraceRecord[capacity]), head(0u), tail(0u), stalls(
+				0u), file(nullptr), stopRequest(false) {
+}
+
+AccessTraceRecorder::~AccessTraceRecorder() {
+	this->close();
+}
+
+bool AccessTraceRecorder::open(const std::string &fileName) {
+	if (file != nullptr) {
+		HV_WARN("Trace file already open")
+		return false;
+	}
+	file = std::fopen(fileName.c_str(), "wb");
+	if (file == nullptr) {
+		HV_WARN("Impossible to create trace file " << fileName)
+		return false;
+	}
+	AccessTraceFileHeader header;
+	std::memset(&header, 0, sizeof(header));
+	std::memcpy(header.magic, "HVRTRACE", sizeof(header.magic));
+	header.version = version;
+	header.recordSize = sizeof(AccessTraceRecord);
+	header.timeResolution = ::sc_core::sc_get_time_resolution().to_seconds();
+	if (std::fwrite(&header, sizeof(header), 1u, file) != 1u) {
+		HV_WARN("Impossible to write trace file header")
+		std::fclose(file);
+		file = nullptr;
+		return false;
+	}
+	head = 0u;
+	tail = 0u;
+	stalls = 0u;
+	stopRequest = false;
+	flusher = std::thread(&AccessTraceRecorder::flushLoop, this);
+	return true;
+}
+
+void AccessTraceRecorder::close() {
+	if (file == nullptr) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(wakeMutex);
+		stopRequest = true;
+	}
+	wakeCond.notify_one();
+	flusher.join();
+	std::fclose(file);
+	file = nullptr;
+}
+
+bool AccessTraceRecorder::isOpen() const {
+	return file != nullptr;
+}
+
+void AccessTraceRecorder::record(const hvuint64_t &timestamp,
+		const hvaddr_t &address, const hvuint8_t* data, const std::size_t &size,
+		const AccessTraceRecord::Command &command,
+		const AccessTraceRecord::Status &status,
+		const AccessTraceRecord::Source &source) {
+	if (file == nullptr) {
+		return;
+	}
+	const hvuint64_t headTmp = head.load(std::memory_order_relaxed);
+	if (headTmp - tail.load(std::memory_order_acquire) == capacity) {
+		// Ring buffer is full: waiting for flushing thread rather than dropping
+		stalls++;
+		wakeCond.notify_one();
+		while (headTmp - tail.load(std::memory_order_acquire) == capacity) {
+			std::this_thread::yield();
+		}
+	}
+	AccessTraceRecord &rec = ring[headTmp & (capacity - 1u)];
+	rec.timestamp = timestamp;
+	rec.address = address;
+	rec.value = 0u;
+	if (data != nullptr) {
+		std::memcpy(&rec.value, data, HV_MIN(size, sizeof(rec.value)));
+	}
+	rec.size = static_cast<hvuint32_t>(size);
+	rec.command = static_cast<hvuint8_t>(command);
+	rec.status = static_cast<hvuint8_t>(status);
+	rec.source = static_cast<hvuint8_t>(source);
+	rec.reserved = 0u;
+	head.store(headTmp + 1u, std::memory_order_release);
+}
+
+hvuint64_t AccessTraceRecorder::now() {
+	return ::sc_core::sc_time_stamp().value();
+}
+
+hvuint64_t AccessTraceRecorder::getRecordCount() const {
+	return head.load(std::memory_order_acquire);
+}
+
+hvuint64_t AccessTraceRecorder::getStallCount() const {
+	return stalls;
+}
+
+void AccessTraceRecorder::flushLoop() {
+	for (;;) {
+		if (this->flushAvailable()) {
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(wakeMutex);
+		if (stopRequest) {
+			lock.unlock();
+			// Last records may have been produced before stop request
+			while (this->flushAvailable()) {
+			}
+			std::fflush(file);
+			return;
+		}
+		wakeCond.wait_for(lock, std::chrono::milliseconds(1));
+	}
+}
+
+std::size_t AccessTraceRecorder::flushAvailable() {
+	const hvuint64_t tailTmp = tail.load(std::memory_order_relaxed);
+	const hvuint64_t headTmp = head.load(std::memory_order_acquire);
+	if (headTmp == tailTmp) {
+		return 0u;
+	}
+	// Writing contiguous records only (up to end of ring buffer)
+	const std::size_t first = tailTmp & (capacity - 1u);
+	const std::size_t count = HV_MIN(
+			HV_MIN(static_cast<std::size_t>(headTmp - tailTmp),
+					capacity - first), flushChunk);
+	if (std::fwrite(&ring[first], sizeof(AccessTraceRecord), count, file)
+			!= count) {
+		HV_ERR("Writing trace file failed")
+		exit(EXIT_FAILURE);
+	}
+	tail.store(tailTmp + count, std::memory_order_release);
+	return count;
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,269 @@
+/**
+ * @file access_trace_recorder.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Binary register-access trace recorder
+ */
+
+#ifndef HV_ACCESS_TRACE_RECORDER_H_
+#define HV_ACCESS_TRACE_RECORDER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <hv/common.h>
+
+namespace hv {
+namespace reg {
+
+/**
+ * Trace file header
+ *
+ * A trace file is made of this header followed by fixed-size records
+ * (AccessTraceRecord), in recording order.
+ */
+struct AccessTraceFileHeader {
+	/**
+	 * File identifier, always "HVRTRACE"
+	 */
+	char magic[8];
+
+	/**
+	 * Format version
+	 */
+	::hv::common::hvuint32_t version;
+
+	/**
+	 * Size of one record in bytes
+	 */
+	::hv::common::hvuint32_t recordSize;
+
+	/**
+	 * Duration of one timestamp unit in seconds (SystemC time resolution)
+	 */
+	double timeResolution;
+};
+
+/**
+ * Register access trace record
+ */
+struct AccessTraceRecord {
+	/**
+	 * Access command
+	 */
+	enum Command {
+		READ = 0, WRITE = 1
+	};
+
+	/**
+	 * Access status
+	 */
+	enum Status {
+		OK = 0, VETOED = 1, ADDRESS_ERROR = 2, GENERIC_ERROR = 3, DENIED = 4
+	};
+
+	/**
+	 * Access origin
+	 */
+	enum Source {
+		TRANSPORT = 0, REGISTER = 1
+	};
+
+	/**
+	 * Simulation time in time resolution units
+	 */
+	::hv::common::hvuint64_t timestamp;
+
+	/**
+	 * Access address
+	 */
+	::hv::common::hvuint64_t address;
+
+	/**
+	 * First 8 bytes of accessed data (LSB first)
+	 */
+	::hv::common::hvuint64_t value;
+
+	/**
+	 * Access size in bytes
+	 */
+	::hv::common::hvuint32_t size;
+
+	/**
+	 * Access command (see Command)
+	 */
+	::hv::common::hvuint8_t command;
+
+	/**
+	 * Access status (see Status)
+	 */
+	::hv::common::hvuint8_t status;
+
+	/**
+	 * Access origin (see Source)
+	 */
+	::hv::common::hvuint8_t source;
+
+	/**
+	 * Reserved
+	 */
+	::hv::common::hvuint8_t reserved;
+};
+
+/**
+ * AccessTraceRecorder class
+ *
+ * Records register accesses in a lock-free single-producer ring buffer which
+ * is flushed to a binary file by a background thread.
+ * record() must always be called from the same thread (the simulation thread).
+ * When the ring buffer is full, record() waits for the flushing thread so
+ * that no record is ever lost.
+ */
+class AccessTraceRecorder {
+public:
+//** Constants **//
+	/**
+	 * Current file format version
+	 */
+	static const ::hv::common::hvuint32_t version = 1u;
+
+//** Constructors **//
+	/**
+	 * AccessTraceRecorder constructor
+	 * @param capacityIn Ring buffer capacity in records (rounded up to a power of 2)
+	 */
+	AccessTraceRecorder(const std::size_t &capacityIn = std::size_t(1u) << 16);
+
+	AccessTraceRecorder(const AccessTraceRecorder &) = delete;
+	AccessTraceRecorder& operator=(const AccessTraceRecorder &) = delete;
+
+//** Destructor **//
+	/**
+	 * Destructor, flushes and closes trace file
+	 */
+	virtual ~AccessTraceRecorder();
+
+//** File management **//
+	/**
+	 * Create trace file and start flushing thread
+	 * @param fileName Trace file name
+	 * @return true if success, false else
+	 */
+	bool open(const std::string &fileName);
+
+	/**
+	 * Flush all pending records, stop flushing thread and close trace file
+	 */
+	void close();
+
+	/**
+	 * Check if trace file is open
+	 * @return true if recording
+	 */
+	bool isOpen() const;
+
+//** Recording **//
+	/**
+	 * Record an access
+	 * @param timestamp Simulation time in time resolution units
+	 * @param address Access address
+	 * @param data Accessed data
+	 * @param size Access size in bytes
+	 * @param command Access command
+	 * @param status Access status
+	 * @param source Access origin
+	 */
+	void record(const ::hv::common::hvuint64_t &timestamp,
+			const ::hv::common::hvaddr_t &address,
+			const ::hv::common::hvuint8_t* data, const std::size_t &size,
+			const AccessTraceRecord::Command &command,
+			const AccessTraceRecord::Status &status,
+			const AccessTraceRecord::Source &source);
+
+	/**
+	 * Get current simulation time in time resolution units
+	 * @return Current simulation time
+	 */
+	static ::hv::common::hvuint64_t now();
+
+//** Statistics **//
+	/**
+	 * Get number of records since trace file was opened
+	 * @return Number of records
+	 */
+	::hv::common::hvuint64_t getRecordCount() const;
+
+	/**
+	 * Get number of times record() had to wait for the flushing thread
+	 * @return Number of stalls
+	 */
+	::hv::common::hvuint64_t getStallCount() const;
+
+protected:
+	/**
+	 * Flushing thread body
+	 */
+	void flushLoop();
+
+	/**
+	 * Write available records to trace file
+	 * @return Number of records written
+	 */
+	std::size_t flushAvailable();
+
+	/**
+	 * Ring buffer capacity (power of 2)
+	 */
+	const std::size_t capacity;
+
+	/**
+	 * Ring buffer
+	 */
+	std::unique_ptr<AccessTraceRecord[]> ring;
+
+	/**
+	 * Producer position (written by recording thread only)
+	 */
+	alignas(64) std::atomic<::hv::common::hvuint64_t> head;
+
+	/**
+	 * Consumer position (written by flushing thread only)
+	 */
+	alignas(64) std::atomic<::hv::common::hvuint64_t> tail;
+
+	/**
+	 * Number of stalls
+	 */
+	::hv::common::hvuint64_t stalls;
+
+	/**
+	 * Trace file
+	 */
+	std::FILE* file;
+
+	/**
+	 * Flushing thread
+	 */
+	std::thread flusher;
+
+	/**
+	 * Stop request for flushing thread
+	 */
+	std::atomic<bool> stopRequest;
+
+	/**
+	 * Flushing thread wake-up
+	 */
+	std::mutex wakeMutex;
+	std::condition_variable wakeCond;
+};
+
+} // namespace reg
+} // namespace hv
+
+#endif /* HV_ACCESS_TRACE_RECORDER_H_ */
@@ -0,0 +1,144 @@
+/**
+ * @file access_trace_replayer.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register-access trace replayer
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <systemc>
+
+#include "access_trace_replayer.h"
+
+using namespace ::hv::common;
+
+namespace hv {
+namespace reg {
+
+AccessTraceReplayer::AccessTraceReplayer() {
+	std::memset(&header, 0, sizeof(header));
+}
+
+AccessTraceReplayer::~AccessTraceReplayer() {
+}
+
+bool AccessTraceReplayer::load(const std::string &fileName) {
+	records.clear();
+	std::FILE* file = std::fopen(fileName.c_str(), "rb");
+	if (file == nullptr) {
+		HV_WARN("Impossible to open trace file " << fileName)
+		return false;
+	}
+	if ((std::fread(&header, sizeof(header), 1u, file) != 1u)
+			|| std::memcmp(header.magic, "HVRTRACE", sizeof(header.magic))
+			|| (header.version != AccessTraceRecorder::version)
+			|| (header.recordSize != sizeof(AccessTraceRecord))) {
+		HV_WARN("Invalid trace file " << fileName)
+		std::fclose(file);
+		return false;
+	}
+	AccessTraceRecord rec;
+	while (std::fread(&rec, sizeof(rec), 1u, file) == 1u) {
+		records.push_back(rec);
+	}
+	std::fclose(file);
+	return true;
+}
+
+const AccessTraceFileHeader& AccessTraceReplayer::getHeader() const {
+	return header;
+}
+
+const std::vector<AccessTraceRecord>& AccessTraceReplayer::getRecords() const {
+	return records;
+}
+
+AccessTraceReplayResult AccessTraceReplayer::replay(RegisterFile &regFile,
+		const AccessTraceRecord::Source &source, const bool &timed) {
+	AccessTraceReplayResult result;
+	const RegisterFile::rmap_t &regs = regFile.getAllRegisters();
+	std::chrono::steady_clock::time_point start =
+			std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < records.size(); i++) {
+		const AccessTraceRecord &rec = records[i];
+		if (rec.source != source) {
+			continue;
+		}
+		RegisterFile::rmap_t::const_iterator it = regs.find(rec.address);
+		if ((it == regs.cend()) || (rec.size > it->second.getSizeInBytes())
+				|| !isReplayable(rec)) {
+			result.skipped++;
+			continue;
+		}
+		if (timed) {
+			waitUntil(rec.timestamp);
+		}
+		this->prepareBuffer(rec);
+		bool success;
+		if (rec.command == AccessTraceRecord::READ) {
+			success = it->second.read(buffer.data(), rec.size);
+		} else {
+			success = it->second.write(buffer.data(), rec.size);
+		}
+		this->check(i, success, result);
+	}
+	result.elapsedSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+bool AccessTraceReplayer::isReplayable(const AccessTraceRecord &rec) {
+	// Data beyond recorded value is unknown
+	return (rec.command == AccessTraceRecord::READ)
+			|| (rec.size <= sizeof(rec.value));
+}
+
+void AccessTraceReplayer::prepareBuffer(const AccessTraceRecord &rec) {
+	if (buffer.size() < rec.size) {
+		buffer.resize(rec.size);
+	}
+	std::memset(buffer.data(), 0, rec.size);
+	if (rec.command == AccessTraceRecord::WRITE) {
+		std::memcpy(buffer.data(), &rec.value,
+				HV_MIN(std::size_t(rec.size), sizeof(rec.value)));
+	}
+}
+
+void AccessTraceReplayer::check(const std::size_t &ind, const bool &success,
+		AccessTraceReplayResult &result) const {
+	const AccessTraceRecord &rec = records[ind];
+	bool mismatch(false);
+	if (rec.command == AccessTraceRecord::READ) {
+		result.reads++;
+		if (rec.size > sizeof(rec.value)) {
+			result.partialReads++;
+		}
+	} else {
+		result.writes++;
+	}
+	if (success != (rec.status == AccessTraceRecord::OK)) {
+		result.statusMismatches++;
+		mismatch = true;
+	} else if (success && (rec.command == AccessTraceRecord::READ)
+			&& std::memcmp(buffer.data(), &rec.value,
+					HV_MIN(std::size_t(rec.size), sizeof(rec.value)))) {
+		result.dataMismatches++;
+		mismatch = true;
+	}
+	if (mismatch) {
+		result.mismatchedRecords.push_back(ind);
+	}
+}
+
+void AccessTraceReplayer::waitUntil(const hvuint64_t &timestamp) {
+	const hvuint64_t now = AccessTraceRecorder::now();
+	if (timestamp > now) {
+		::sc_core::wait(::sc_core::sc_time::from_value(timestamp - now));
+	}
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,215 @@
+/**
+ * @file access_trace_replayer.h
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register-access trace replayer
+ */
+
+#ifndef HV_ACCESS_TRACE_REPLAYER_H_
+#define HV_ACCESS_TRACE_REPLAYER_H_
+
+#include <chrono>
+#include <vector>
+#include <hv/common.h>
+#include <hv/communication.h>
+
+#include "access_trace_recorder.h"
+#include "../registerfile/registerfile.h"
+
+namespace hv {
+namespace reg {
+
+/**
+ * Result of a trace replay
+ */
+struct AccessTraceReplayResult {
+
+	AccessTraceReplayResult() :
+			reads(0u), writes(0u), skipped(0u), partialReads(0u), dataMismatches(
+					0u), statusMismatches(0u), elapsedSeconds(0.0) {
+	}
+
+	/**
+	 * Get number of replayed accesses
+	 * @return Number of replayed accesses
+	 */
+	::hv::common::hvuint64_t getAccesses() const {
+		return reads + writes;
+	}
+
+	/**
+	 * Get replay throughput
+	 * @return Replayed accesses per second of host time
+	 */
+	double getAccessesPerSecond() const {
+		return elapsedSeconds > 0.0 ? getAccesses() / elapsedSeconds : 0.0;
+	}
+
+	/**
+	 * Check if replay matched trace
+	 * @return true if no data or status mismatch was found
+	 */
+	bool isMatching() const {
+		return !dataMismatches && !statusMismatches;
+	}
+
+	/**
+	 * Number of replayed reads and writes
+	 */
+	::hv::common::hvuint64_t reads, writes;
+
+	/**
+	 * Number of records which could not be replayed on target, including
+	 * writes larger than recorded data
+	 */
+	::hv::common::hvuint64_t skipped;
+
+	/**
+	 * Number of replayed reads larger than recorded data, only checked on
+	 * recorded bytes
+	 */
+	::hv::common::hvuint64_t partialReads;
+
+	/**
+	 * Number of successful reads returning other data than recorded
+	 */
+	::hv::common::hvuint64_t dataMismatches;
+
+	/**
+	 * Number of accesses whose status differs from recorded one
+	 */
+	::hv::common::hvuint64_t statusMismatches;
+
+	/**
+	 * Indices of mismatching records in trace
+	 */
+	std::vector<std::size_t> mismatchedRecords;
+
+	/**
+	 * Host time spent replaying in seconds
+	 */
+	double elapsedSeconds;
+};
+
+/**
+ * AccessTraceReplayer class
+ *
+ * Replays a trace written by AccessTraceRecorder on a register file or
+ * through a memory-mapped initiator socket, and checks read data and access
+ * status against recorded ones.
+ * Only the first 8 bytes of each access are recorded: larger writes are
+ * skipped, and larger reads are replayed but only checked on them.
+ * In untimed mode, accesses are replayed back to back. In timed mode, replay
+ * waits until the recorded timestamp of each access, so it must be run from
+ * a SystemC thread.
+ */
+class AccessTraceReplayer {
+public:
+	typedef ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedProtocolTypes::tlm_payload_type mem_access_payload_type;
+
+//** Constructors **//
+	AccessTraceReplayer();
+
+//** Destructor **//
+	virtual ~AccessTraceReplayer();
+
+//** Trace loading **//
+	/**
+	 * Load trace file
+	 * @param fileName Trace file name
+	 * @return true if trace file is valid, false else
+	 */
+	bool load(const std::string &fileName);
+
+	/**
+	 * Get header of loaded trace
+	 * @return Trace header
+	 */
+	const AccessTraceFileHeader& getHeader() const;
+
+	/**
+	 * Get loaded records
+	 * @return Trace records
+	 */
+	const std::vector<AccessTraceRecord>& getRecords() const;
+
+//** Replay **//
+	/**
+	 * Replay trace on register file
+	 *
+	 * Records whose address is not a register of the register file, or whose
+	 * size exceeds register size, are skipped, as well as writes larger than
+	 * recorded data.
+	 * @param regFile Target register file
+	 * @param source Origin of records to replay
+	 * @param timed Wait for recorded timestamps if true
+	 * @return Replay result
+	 */
+	AccessTraceReplayResult replay(RegisterFile &regFile,
+			const AccessTraceRecord::Source &source =
+					AccessTraceRecord::REGISTER, const bool &timed = false);
+
+	/**
+	 * Replay TRANSPORT records through a memory-mapped initiator socket
+	 *
+	 * Writes larger than recorded data are skipped.
+	 * @param socket Bound initiator socket
+	 * @param timed Wait for recorded timestamps if true
+	 * @return Replay result
+	 */
+	template<typename SOCKET> AccessTraceReplayResult replay(SOCKET &socket,
+			const bool &timed = false);
+
+protected:
+	/**
+	 * Check if record holds all data needed to replay it
+	 * @param rec Trace record
+	 * @return false for writes larger than recorded data, true else
+	 */
+	static bool isReplayable(const AccessTraceRecord &rec);
+
+	/**
+	 * Prepare access buffer from a record
+	 * @param rec Trace record
+	 */
+	void prepareBuffer(const AccessTraceRecord &rec);
+
+	/**
+	 * Check a replayed access against its record
+	 * @param ind Record index
+	 * @param success true if access succeeded
+	 * @param result Replay result to update
+	 */
+	void check(const std::size_t &ind, const bool &success,
+			AccessTraceReplayResult &result) const;
+
+	/**
+	 * Wait until a recorded timestamp (SystemC thread only)
+	 * @param timestamp Timestamp in time resolution units
+	 */
+	static void waitUntil(const ::hv::common::hvuint64_t &timestamp);
+
+	/**
+	 * Header of loaded trace
+	 */
+	AccessTraceFileHeader header;
+
+	/**
+	 * Loaded records
+	 */
+	std::vector<AccessTraceRecord> records;
+
+	/**
+	 * Access buffer
+	 */
+	std::vector<::hv::common::hvuint8_t> buffer;
+};
+
+} // namespace reg
+} // namespace hv
+
+#include "access_trace_replayer.hpp"
+
+#endif /* HV_ACCESS_TRACE_REPLAYER_H_ */
@@ -0,0 +1,50 @@
+/**
+ * @file access_trace_replayer.hpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Register-access trace replayer
+ */
+
+namespace hv {
+namespace reg {
+
+template<typename SOCKET> AccessTraceReplayResult AccessTraceReplayer::replay(
+		SOCKET &socket, const bool &timed) {
+	namespace mm = ::hv::communication::tlm2::protocols::memorymapped;
+	AccessTraceReplayResult result;
+	mem_access_payload_type txn;
+	std::chrono::steady_clock::time_point start =
+			std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < records.size(); i++) {
+		const AccessTraceRecord &rec = records[i];
+		if (rec.source != AccessTraceRecord::TRANSPORT) {
+			continue;
+		}
+		if (!isReplayable(rec)) {
+			result.skipped++;
+			continue;
+		}
+		if (timed) {
+			waitUntil(rec.timestamp);
+		}
+		this->prepareBuffer(rec);
+		::sc_core::sc_time delay(::sc_core::SC_ZERO_TIME);
+		txn.setAddress(rec.address);
+		txn.setDataPtr(buffer.data());
+		txn.setDataLength(rec.size);
+		txn.setCommand(
+				rec.command == AccessTraceRecord::READ ?
+						mm::MEM_MAP_READ_COMMAND : mm::MEM_MAP_WRITE_COMMAND);
+		txn.setResponseStatus(mm::MEM_MAP_INCOMPLETE_RESPONSE);
+		socket->b_transport(txn, delay);
+		this->check(i, !txn.isResponseError(), result);
+	}
+	result.elapsedSeconds = std::chrono::duration<double>(
+			std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+} // namespace reg
+} // namespace hv
@@ -0,0 +1,200 @@
+/**
+ * @file access_trace_recorder_test.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for access_trace_recorder.h and access_trace_replayer.h
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+#include <hv/common.h>
+
+#include "trace/access_trace_recorder.h"
+#include "trace/access_trace_replayer.h"
+#include "registerfile/registerfile.h"
+
+using namespace ::hv::common;
+using namespace ::hv::reg;
+
+class AccessTraceRecorderTest: public ::testing::Test {
+	virtual void SetUp() {
+	}
+
+	virtual void TearDown() {
+		std::remove(traceFile);
+	}
+
+protected:
+	const char* traceFile = "access_trace_recorder_test.hvtrace";
+
+	bool load(AccessTraceFileHeader &header,
+			std::vector<AccessTraceRecord> &records) {
+		std::FILE* f = std::fopen(traceFile, "rb");
+		if (f == nullptr) {
+			return false;
+		}
+		bool ret = std::fread(&header, sizeof(header), 1u, f) == 1u;
+		AccessTraceRecord rec;
+		while (ret && std::fread(&rec, sizeof(rec), 1u, f) == 1u) {
+			records.push_back(rec);
+		}
+		std::fclose(f);
+		return ret;
+	}
+};
+
+TEST_F(AccessTraceRecorderTest, RegisterFileTraceTest) {
+	RegisterFile rf("RegFile", "Traced register file", 4);
+	RegisterFile rfSub("SubRegFile", "Traced sub-register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Reg0", "", RW, 0x11u));
+	ASSERT_TRUE(rfSub.createRegister(0x0, 32, "SubReg0", "", RW, 0x22u));
+
+	AccessTraceRecorder rec;
+	ASSERT_TRUE(rec.open(traceFile));
+	ASSERT_TRUE(rec.isOpen());
+	rf.setTraceRecorder(&rec);
+	// Registers inserted later are traced as well
+	ASSERT_TRUE(rf.addRegisterFile(0x10, rfSub));
+
+	hvuint32_t val(0xCAFEu);
+	ASSERT_TRUE(rf.write(0x10, reinterpret_cast<hvuint8_t*>(&val), 4));
+	val = 0u;
+	ASSERT_TRUE(rf.read(0x0, reinterpret_cast<hvuint8_t*>(&val), 4));
+	rf.getRegister(0x0).registerPreWriteCallback(
+			[](const RegisterWriteEvent&) {return false;});
+	ASSERT_FALSE(rf.write(0x0, reinterpret_cast<hvuint8_t*>(&val), 4));
+	ASSERT_EQ(rec.getRecordCount(), hvuint64_t(3));
+	rec.close();
+	ASSERT_FALSE(rec.isOpen());
+
+	AccessTraceFileHeader header;
+	std::vector<AccessTraceRecord> records;
+	ASSERT_TRUE(load(header, records));
+	ASSERT_EQ(std::memcmp(header.magic, "HVRTRACE", 8), 0);
+	ASSERT_EQ(header.version, AccessTraceRecorder::version);
+	ASSERT_EQ(header.recordSize, hvuint32_t(sizeof(AccessTraceRecord)));
+	ASSERT_EQ(records.size(), std::size_t(3));
+	ASSERT_EQ(records[0].address, hvuint64_t(0x10));
+	ASSERT_EQ(records[0].value, hvuint64_t(0xCAFEu));
+	ASSERT_EQ(records[0].size, hvuint32_t(4));
+	ASSERT_EQ(records[0].command, hvuint8_t(AccessTraceRecord::WRITE));
+	ASSERT_EQ(records[0].status, hvuint8_t(AccessTraceRecord::OK));
+	ASSERT_EQ(records[0].source, hvuint8_t(AccessTraceRecord::REGISTER));
+	ASSERT_EQ(records[1].address, hvuint64_t(0x0));
+	ASSERT_EQ(records[1].value, hvuint64_t(0x11u));
+	ASSERT_EQ(records[1].command, hvuint8_t(AccessTraceRecord::READ));
+	ASSERT_EQ(records[2].status, hvuint8_t(AccessTraceRecord::VETOED));
+
+	rf.setTraceRecorder(nullptr);
+	ASSERT_EQ(rfSub.getRegister(0x0).getTraceRecorder(), nullptr);
+}
+
+TEST_F(AccessTraceRecorderTest, FullRingBufferTest) {
+	// A tiny ring buffer forces the producer to wait: no record is dropped
+	AccessTraceRecorder rec(4u);
+	ASSERT_TRUE(rec.open(traceFile));
+	for (hvuint64_t i = 0u; i < 10000u; i++) {
+		rec.record(i, i * 4u, reinterpret_cast<hvuint8_t*>(&i), sizeof(i),
+				AccessTraceRecord::WRITE, AccessTraceRecord::OK,
+				AccessTraceRecord::TRANSPORT);
+	}
+	rec.close();
+
+	AccessTraceFileHeader header;
+	std::vector<AccessTraceRecord> records;
+	ASSERT_TRUE(load(header, records));
+	ASSERT_EQ(records.size(), std::size_t(10000u));
+	for (std::size_t i = 0u; i < records.size(); i++) {
+		ASSERT_EQ(records[i].timestamp, hvuint64_t(i));
+		ASSERT_EQ(records[i].address, hvuint64_t(i * 4u));
+		ASSERT_EQ(records[i].value, hvuint64_t(i));
+	}
+}
+
+TEST_F(AccessTraceRecorderTest, ReplayTest) {
+	RegisterFile rf("RegFile", "Traced register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Reg0", "", RW, 0x11u));
+	ASSERT_TRUE(rf.createRegister(0x4, 16, "Reg1", "", RW, 0x22u));
+	AccessTraceRecorder rec;
+	ASSERT_TRUE(rec.open(traceFile));
+	rf.setTraceRecorder(&rec);
+	hvuint32_t val(0u);
+	for (hvuint32_t i = 0u; i < 100u; i++) {
+		ASSERT_TRUE(rf.write(0x0, reinterpret_cast<hvuint8_t*>(&i), 4));
+		ASSERT_TRUE(rf.read(0x0, reinterpret_cast<hvuint8_t*>(&val), 4));
+		ASSERT_TRUE(rf.read(0x4, reinterpret_cast<hvuint8_t*>(&val), 2));
+	}
+	rf.setTraceRecorder(nullptr);
+	rec.close();
+
+	AccessTraceReplayer replayer;
+	ASSERT_FALSE(replayer.load("missing_trace_file.hvtrace"));
+	ASSERT_TRUE(replayer.load(traceFile));
+	ASSERT_EQ(replayer.getRecords().size(), std::size_t(300));
+
+	// Replaying on an identical register map matches the trace
+	RegisterFile rfSame("RegFileSame", "Identical register file", 4);
+	ASSERT_TRUE(rfSame.createRegister(0x0, 32, "Reg0", "", RW, 0x11u));
+	ASSERT_TRUE(rfSame.createRegister(0x4, 16, "Reg1", "", RW, 0x22u));
+	AccessTraceReplayResult res = replayer.replay(rfSame);
+	ASSERT_TRUE(res.isMatching());
+	ASSERT_EQ(res.reads, hvuint64_t(200));
+	ASSERT_EQ(res.writes, hvuint64_t(100));
+	ASSERT_EQ(res.skipped, hvuint64_t(0));
+	ASSERT_EQ(hvuint32_t(rfSame.getRegister(0x0)), hvuint32_t(99u));
+
+	// A changed reset value, a vetoed write and a missing register are reported
+	RegisterFile rfDiff("RegFileDiff", "Modified register file", 4);
+	ASSERT_TRUE(rfDiff.createRegister(0x0, 32, "Reg0", "", RW, 0x11u));
+	ASSERT_TRUE(rfDiff.createRegister(0x8, 16, "Reg1", "", RW, 0x22u));
+	rfDiff.getRegister(0x0).registerPreWriteCallback(
+			[](const RegisterWriteEvent &ev) {
+				return hvuint32_t(ev.newValue) != 50u;
+			});
+	res = replayer.replay(rfDiff);
+	ASSERT_FALSE(res.isMatching());
+	ASSERT_EQ(res.skipped, hvuint64_t(100));
+	ASSERT_EQ(res.statusMismatches, hvuint64_t(1));
+	ASSERT_EQ(res.dataMismatches, hvuint64_t(1));
+	ASSERT_EQ(res.mismatchedRecords.size(), std::size_t(2));
+	ASSERT_EQ(res.mismatchedRecords[0], std::size_t(150));
+	ASSERT_EQ(res.mismatchedRecords[1], std::size_t(151));
+}
+
+TEST_F(AccessTraceRecorderTest, LargeAccessReplayTest) {
+	RegisterFile rf("RegFile", "Traced register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 128, "Wide", "", RW));
+	AccessTraceRecorder rec;
+	ASSERT_TRUE(rec.open(traceFile));
+	rf.setTraceRecorder(&rec);
+	hvuint8_t data[16];
+	for (std::size_t i = 0; i < sizeof(data); i++) {
+		data[i] = hvuint8_t(i + 1u);
+	}
+	ASSERT_TRUE(rf.write(0x0, data, 16));
+	ASSERT_TRUE(rf.read(0x0, data, 16));
+	rf.setTraceRecorder(nullptr);
+	rec.close();
+
+	// Wide write is skipped instead of being replayed with a zero-filled tail
+	AccessTraceReplayer replayer;
+	ASSERT_TRUE(replayer.load(traceFile));
+	RegisterFile rfSame("RegFileSame", "Identical register file", 4);
+	ASSERT_TRUE(rfSame.createRegister(0x0, 128, "Wide", "", RW));
+	std::memset(data, 0xA5, sizeof(data));
+	ASSERT_TRUE(rfSame.write(0x0, data, 16));
+	AccessTraceReplayResult res = replayer.replay(rfSame);
+	ASSERT_EQ(res.skipped, hvuint64_t(1));
+	ASSERT_EQ(res.writes, hvuint64_t(0));
+	ASSERT_EQ(res.reads, hvuint64_t(1));
+	// Read is replayed, but only checked on recorded bytes
+	ASSERT_EQ(res.partialReads, hvuint64_t(1));
+	ASSERT_EQ(res.dataMismatches, hvuint64_t(1));
+	ASSERT_TRUE(rfSame.read(0x0, data, 16));
+	ASSERT_EQ(data[0], hvuint8_t(0xA5));
+	ASSERT_EQ(data[15], hvuint8_t(0xA5));
+}
@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
+#include <vector>
 #include <gtest/gtest.h>
 #include <hv/common.h>
 
@@ -468,6 +469,153 @@ TEST_F(RegisterTest, CallbackRegistrationUnregistrationTest) {
 
 }
 
+TEST_F(RegisterTest, ChangeCallbackTest) {
+	Register reg(32, "Register", "Great Register", RW, 0);
+	reg.createField("Field1", 7, 0);
+	reg.createField("Field2", 15, 8);
+	std::size_t field2Changes(0u), maskChanges(0u);
+	hvuint32_t lastOld(0u), lastNew(0u);
+	reg.registerFieldChangeCallback("Field2",
+			[&](const RegisterWriteEvent &ev) {
+				field2Changes++;
+				lastOld = hvuint32_t(ev.oldValue);
+				lastNew = hvuint32_t(ev.newValue);
+			});
+	hvcbID_t maskId = reg.registerChangeCallback(BitVector(32, 0x80000001u),
+			[&maskChanges](const RegisterWriteEvent&) {maskChanges++;});
+	ASSERT_EQ(reg.howManyChangeCallbacks(), std::size_t(2));
+	ASSERT_TRUE(reg.hasCallbacks());
+	ASSERT_FALSE(reg.isSideEffectFree());
+	ASSERT_TRUE(reg.isWordAccessFree());
+
+	// Writes not modifying watched bits do not call callbacks
+	hvuint32_t value(0x000000F0u);
+	ASSERT_TRUE(reg.write(reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(field2Changes, std::size_t(0));
+	ASSERT_EQ(maskChanges, std::size_t(0));
+	value = 0x00001200u;
+	ASSERT_TRUE(reg.write(reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(field2Changes, std::size_t(1));
+	ASSERT_EQ(lastOld, hvuint32_t(0x000000F0u));
+	ASSERT_EQ(lastNew, hvuint32_t(0x00001200u));
+	ASSERT_TRUE(reg.write(reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(field2Changes, std::size_t(1));
+
+	// Word writes check changes the same way
+	value = 0x80001200u;
+	ASSERT_TRUE(reg.writeWord<hvuint32_t>(reinterpret_cast<hvuint8_t*>(&value)));
+	ASSERT_EQ(field2Changes, std::size_t(1));
+	ASSERT_EQ(maskChanges, std::size_t(1));
+	value = 0x00003400u;
+	ASSERT_TRUE(reg.writeWord<hvuint32_t>(reinterpret_cast<hvuint8_t*>(&value)));
+	ASSERT_EQ(field2Changes, std::size_t(2));
+	ASSERT_EQ(maskChanges, std::size_t(2));
+	ASSERT_EQ(lastOld, hvuint32_t(0x80001200u));
+
+	ASSERT_TRUE(reg.unregisterChangeCallback(maskId));
+	ASSERT_FALSE(reg.unregisterChangeCallback(maskId));
+	value = 0x80003400u;
+	ASSERT_TRUE(reg.writeWord<hvuint32_t>(reinterpret_cast<hvuint8_t*>(&value)));
+	ASSERT_EQ(maskChanges, std::size_t(2));
+	reg.unregisterAllCallbacks();
+	ASSERT_TRUE(reg.isSideEffectFree());
+}
+
+TEST_F(RegisterTest, AsyncCallbackTest) {
+	Register reg(32, "Register", "Great Register", RW, 0);
+	std::vector<hvuint32_t> written;
+	std::size_t reads(0u);
+	reg.registerAsyncPostWriteCallback(
+			[&written](const RegisterWriteEvent &ev) {
+				written.push_back(hvuint32_t(ev.newValue));
+			});
+	hvcbID_t readId = reg.registerAsyncPostReadCallback(
+			[&reads](const RegisterReadEvent&) {reads++;});
+	ASSERT_EQ(reg.howManyAsyncCallbacks(), std::size_t(2));
+	ASSERT_TRUE(reg.hasCallbacks());
+	ASSERT_FALSE(reg.isWordAccessFree());
+
+	// Without worker pool, callbacks are called synchronously
+	hvuint32_t value(1u);
+	ASSERT_TRUE(reg.write(reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(written.size(), std::size_t(1));
+
+	// With worker pool, callbacks of a register run in access order
+	CallbackWorkerPool pool(4u, 8u);
+	reg.setCallbackWorkerPool(&pool);
+	for (hvuint32_t i = 2u; i <= 100u; i++) {
+		ASSERT_TRUE(reg.write(reinterpret_cast<hvuint8_t*>(&i), 4));
+	}
+	ASSERT_TRUE(reg.read(reinterpret_cast<hvuint8_t*>(&value), 4));
+	pool.waitIdle(&reg);
+	ASSERT_EQ(pool.howManyPending(), std::size_t(0));
+	ASSERT_EQ(written.size(), std::size_t(100));
+	for (hvuint32_t i = 0u; i < 100u; i++) {
+		ASSERT_EQ(written[i], i + 1u);
+	}
+	ASSERT_EQ(reads, std::size_t(1));
+	ASSERT_EQ(pool.getCompleted(), hvuint64_t(100));
+
+	ASSERT_TRUE(reg.unregisterAsyncCallback(readId));
+	ASSERT_FALSE(reg.unregisterAsyncCallback(readId));
+	reg.unregisterAllCallbacks();
+	ASSERT_EQ(reg.howManyAsyncCallbacks(), std::size_t(0));
+	reg.setCallbackWorkerPool(nullptr);
+}
+
+TEST_F(RegisterTest, ValueProviderTest) {
+	hvuint32_t ticks(0u);
+	std::size_t calls(0u);
+	ValueProviderRegister<hvuint32_t> reg(16, "Counter", [&]() {
+		calls++;
+		return ticks;
+	});
+	ASSERT_TRUE(reg.isValueProvided());
+	ASSERT_FALSE(reg.isWordAccessFree());
+	ASSERT_FALSE(reg.isSideEffectFree());
+	ASSERT_EQ(calls, std::size_t(0));
+
+	// Value is computed on each read, truncated to register size
+	ticks = 0x12345u;
+	hvuint16_t value(0u);
+	ASSERT_TRUE(reg.readWord<hvuint16_t>(reinterpret_cast<hvuint8_t*>(&value)));
+	ASSERT_EQ(value, hvuint16_t(0x2345u));
+	ticks = 7u;
+	ASSERT_TRUE(reg.read(reinterpret_cast<hvuint8_t*>(&value), 2));
+	ASSERT_EQ(value, hvuint16_t(7u));
+	ticks = 8u;
+	reg.debugRead(reinterpret_cast<hvuint8_t*>(&value), 2);
+	ASSERT_EQ(value, hvuint16_t(8u));
+	ticks = 9u;
+	ASSERT_EQ(hvuint32_t(reg.getValue()), hvuint32_t(9u));
+	ASSERT_EQ(calls, std::size_t(4));
+
+	// Callbacks see provided value
+	hvuint32_t seen(0u);
+	reg.registerPostReadCallback([&seen](const RegisterReadEvent &ev) {
+		seen = hvuint32_t(ev.value);
+	});
+	ticks = 10u;
+	ASSERT_TRUE(reg.read(reinterpret_cast<hvuint8_t*>(&value), 2));
+	ASSERT_EQ(value, hvuint16_t(10u));
+	ASSERT_EQ(seen, hvuint32_t(10u));
+	// Provided value is not stored
+	ASSERT_EQ(hvuint16_t(*static_cast<const hvuint16_t*>(reg.getDataAddress())),
+			hvuint16_t(0u));
+
+	// Casts, comparisons and fields see provided value
+	reg.createField("High", 15, 8);
+	ticks = 0xA55Au;
+	ASSERT_EQ(hvuint16_t(reg), hvuint16_t(0xA55Au));
+	ASSERT_EQ(hvuint8_t(reg("High")), hvuint8_t(0xA5u));
+	ASSERT_EQ(hvuint8_t(reg(7, 0)), hvuint8_t(0x5Au));
+	ASSERT_TRUE(bool(reg[1]));
+	Register other(16, "Other", "", RW, 0xA55Au);
+	ASSERT_TRUE(reg == other);
+	ASSERT_FALSE(!reg);
+	ASSERT_EQ(reg.toString(), std::string("1010010101011010"));
+}
+
 // Some function we can register as post-read callback
 void displayValuesAfterWriting(const ::hv::reg::RegisterWriteEvent &ev) {
 	std::cout << ev.rh.getName() << " - Write event old value: " << ev.oldValue
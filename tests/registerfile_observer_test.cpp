@@ -0,0 +1,108 @@
+/**
+ * @file registerfile_observer_test.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for registerfile_observer.h
+ */
+
+#include <atomic>
+#include <thread>
+#include <gtest/gtest.h>
+#include <hv/common.h>
+
+#include "registerfile/registerfile_observer.h"
+
+using namespace ::hv::common;
+using namespace ::hv::reg;
+
+class RegisterFileObserverTest: public ::testing::Test {
+	virtual void SetUp() {
+	}
+
+	virtual void TearDown() {
+	}
+};
+
+TEST_F(RegisterFileObserverTest, PublishTest) {
+	RegisterFile rf("RegFile", "Observed register file", 4);
+	RegisterFile rfSub("SubRegFile", "Observed sub-register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Reg0", "", RW, 0x11u));
+	ASSERT_TRUE(rf.createRegister(0x4, 16, "Reg1", "", RW, 0x22u));
+	ASSERT_TRUE(rfSub.createRegister(0x0, 32, "SubReg0", "", RW, 0x33u));
+	ASSERT_TRUE(rf.addRegisterFile(0x10, rfSub));
+
+	RegisterFileObserver obs(rf);
+	ASSERT_EQ(obs.getRegisterCount(), std::size_t(3));
+	ASSERT_EQ(obs.getImageSize(), std::size_t(4 + 2 + 4));
+	ASSERT_EQ(obs.getEpoch(), hvuint64_t(0));
+
+	hvuint32_t val(0u);
+	hvuint64_t epoch(1u);
+	ASSERT_TRUE(obs.read(0x10, reinterpret_cast<hvuint8_t*>(&val), 4, &epoch));
+	ASSERT_EQ(val, hvuint32_t(0x33u));
+	ASSERT_EQ(epoch, hvuint64_t(0));
+	ASSERT_FALSE(obs.read(0x8, reinterpret_cast<hvuint8_t*>(&val), 4));
+
+	// Nothing changed
+	ASSERT_EQ(obs.publish(), std::size_t(0));
+	ASSERT_EQ(obs.getEpoch(), hvuint64_t(0));
+
+	// Modifications are only visible after publication
+	rf.getRegister(0x0) = hvuint32_t(0xCAFEu);
+	rfSub.getRegister(0x0) = hvuint32_t(0xBEEFu);
+	ASSERT_TRUE(obs.read(0x0, reinterpret_cast<hvuint8_t*>(&val), 4));
+	ASSERT_EQ(val, hvuint32_t(0x11u));
+	ASSERT_EQ(obs.publish(), std::size_t(2));
+	ASSERT_EQ(obs.getEpoch(), hvuint64_t(1));
+	ASSERT_TRUE(obs.read(0x0, reinterpret_cast<hvuint8_t*>(&val), 4));
+	ASSERT_EQ(val, hvuint32_t(0xCAFEu));
+
+	// Both buffers must remain coherent across incremental publications
+	rf.getRegister(0x4) = hvuint16_t(0x4444u);
+	ASSERT_EQ(obs.publish(), std::size_t(1));
+	rf.getRegister(0x4) = hvuint16_t(0x5555u);
+	ASSERT_EQ(obs.publish(), std::size_t(1));
+	std::vector<hvuint8_t> image;
+	ASSERT_EQ(obs.snapshot(image), hvuint64_t(3));
+	const std::vector<RegisterFileObserver::Entry> &entries = obs.getEntries();
+	hvuint32_t v0(0u), v2(0u);
+	hvuint16_t v1(0u);
+	std::memcpy(&v0, image.data() + entries[0].offset, 4);
+	std::memcpy(&v1, image.data() + entries[1].offset, 2);
+	std::memcpy(&v2, image.data() + entries[2].offset, 4);
+	ASSERT_EQ(v0, hvuint32_t(0xCAFEu));
+	ASSERT_EQ(v1, hvuint16_t(0x5555u));
+	ASSERT_EQ(v2, hvuint32_t(0xBEEFu));
+}
+
+TEST_F(RegisterFileObserverTest, ConcurrentReadTest) {
+	RegisterFile rf("RegFile", "Observed register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Reg0", "", RW, 0u));
+	ASSERT_TRUE(rf.createRegister(0x4, 32, "Reg1", "", RW, 0u));
+	RegisterFileObserver obs(rf);
+
+	// Both registers are always published with the same value:
+	// a consistent snapshot never shows them different
+	std::atomic<bool> stop(false);
+	std::atomic<bool> consistent(true);
+	std::thread reader([&]() {
+		std::vector<hvuint8_t> image;
+		while (!stop.load()) {
+			obs.snapshot(image);
+			if (std::memcmp(image.data(), image.data() + 4, 4)) {
+				consistent = false;
+			}
+		}
+	});
+	for (hvuint32_t i = 1u; i < 20000u; i++) {
+		rf.getRegister(0x0) = i;
+		rf.getRegister(0x4) = i;
+		obs.publish();
+	}
+	stop = true;
+	reader.join();
+	ASSERT_TRUE(consistent.load());
+	ASSERT_EQ(obs.getEpoch(), hvuint64_t(19999u));
+}
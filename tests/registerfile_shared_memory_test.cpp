@@ -0,0 +1,175 @@
+/**
+ * @file registerfile_shared_memory_test.cpp
+ * @author Hiventive <contact@hiventive.com>
+ * @date Oct, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Tests for registerfile_shared_memory.h
+ */
+
+#include <gtest/gtest.h>
+#include <hv/common.h>
+
+#include "registerfile/registerfile_shared_memory.h"
+
+using namespace ::hv::common;
+using namespace ::hv::reg;
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+
+TEST(RegisterFileSharedMemoryTest, ExportTest) {
+	RegisterFile rf("RegFile", "Exported register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Status", "", RW, 0x1234u));
+	ASSERT_TRUE(rf.createRegister(0x8, 8, "Ctrl", "", RW, 0x5u));
+
+	const std::string segName("/hvregister-test-" + std::to_string(getpid()));
+	RegisterFileSharedMemory shm(rf);
+	ASSERT_TRUE(shm.open(segName));
+	ASSERT_TRUE(shm.isOpen());
+
+	RegisterFileSharedMemoryReader reader;
+	ASSERT_TRUE(reader.open(segName));
+	ASSERT_EQ(reader.getRegisterCount(), std::size_t(2));
+	ASSERT_EQ(reader.getRegisterName(0), std::string("Status"));
+	ASSERT_EQ(reader.getRegisterName(1), std::string("Ctrl"));
+	ASSERT_EQ(reader.getRegisterAddress(1), hvaddr_t(0x8));
+	ASSERT_EQ(reader.getHeader()->registerCount, hvuint32_t(2));
+
+	hvuint32_t status(0u);
+	hvuint8_t ctrl(0u);
+	ASSERT_TRUE(reader.read(0x0, reinterpret_cast<hvuint8_t*>(&status), 4));
+	ASSERT_TRUE(reader.read(0x8, &ctrl, 1));
+	ASSERT_EQ(status, hvuint32_t(0x1234u));
+	ASSERT_EQ(ctrl, hvuint8_t(0x5u));
+	ASSERT_FALSE(reader.read(0x4, &ctrl, 1));
+
+	// Incremental publication
+	rf.getRegister(0x0) = hvuint32_t(0xABCDu);
+	ASSERT_EQ(shm.publish(), std::size_t(1));
+	ASSERT_EQ(shm.publish(), std::size_t(0));
+	hvuint64_t epoch(0u);
+	ASSERT_TRUE(
+			reader.read(0x0, reinterpret_cast<hvuint8_t*>(&status), 4, &epoch));
+	ASSERT_EQ(status, hvuint32_t(0xABCDu));
+	ASSERT_EQ(epoch, hvuint64_t(1));
+
+	rf.getRegister(0x8) = hvuint8_t(0x7u);
+	ASSERT_TRUE(shm.publish(0x8));
+	ASSERT_FALSE(shm.publish(0x8));
+	ASSERT_TRUE(reader.read(0x8, &ctrl, 1));
+	ASSERT_EQ(ctrl, hvuint8_t(0x7u));
+
+	// Publication by register, e.g. accessed at an alias address
+	RegisterFile alias("Alias", "Aliasing register file", 4);
+	ASSERT_TRUE(alias.addRegister(0x100, rf.getRegister(0x8)));
+	alias.getRegister(0x100) = hvuint8_t(0x9u);
+	rf.getRegister(0x0) = hvuint32_t(0x4321u);
+	ASSERT_FALSE(shm.publish(0x100));
+	ASSERT_TRUE(shm.publish(alias.getRegister(0x100)));
+	ASSERT_FALSE(shm.publish(alias.getRegister(0x100)));
+	ASSERT_TRUE(reader.read(0x8, &ctrl, 1));
+	ASSERT_EQ(ctrl, hvuint8_t(0x9u));
+	// Other modified registers are left to next publication
+	ASSERT_TRUE(reader.read(0x0, reinterpret_cast<hvuint8_t*>(&status), 4));
+	ASSERT_EQ(status, hvuint32_t(0xABCDu));
+	Register other(32, "Other", "", RW);
+	ASSERT_FALSE(shm.publish(other));
+
+	reader.close();
+	shm.close();
+	ASSERT_FALSE(reader.open(segName));
+}
+
+class StalledSharedMemory: public RegisterFileSharedMemory {
+public:
+	StalledSharedMemory(const RegisterFile &regFileIn) :
+			RegisterFileSharedMemory(regFileIn) {
+	}
+
+	void stall() {
+		this->beginUpdate();
+	}
+
+	SharedMemoryHeader& header() {
+		return *reinterpret_cast<SharedMemoryHeader*>(segment);
+	}
+
+	SharedMemoryEntry& entry(const std::size_t &ind) {
+		return reinterpret_cast<SharedMemoryEntry*>(segment
+				+ this->header().entriesOffset)[ind];
+	}
+};
+
+TEST(RegisterFileSharedMemoryTest, LiveSegmentTest) {
+	RegisterFile rf("RegFile", "Exported register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Status", "", RW, 0x1234u));
+
+	const std::string segName("/hvregister-live-" + std::to_string(getpid()));
+	StalledSharedMemory shm(rf);
+	ASSERT_TRUE(shm.open(segName));
+
+	// Live segment is not truncated by another exporter
+	RegisterFileSharedMemory other(rf);
+	ASSERT_FALSE(other.open(segName));
+	RegisterFileSharedMemoryReader reader;
+	ASSERT_TRUE(reader.open(segName));
+	hvuint32_t status(0u);
+	ASSERT_TRUE(reader.read(0x0, reinterpret_cast<hvuint8_t*>(&status), 4));
+	ASSERT_EQ(status, hvuint32_t(0x1234u));
+
+	// Reader gives up on a writer stalled in an update
+	shm.stall();
+	ASSERT_FALSE(reader.read(0x0, reinterpret_cast<hvuint8_t*>(&status), 4));
+
+	// Explicit replacement
+	ASSERT_TRUE(other.open(segName, true));
+	reader.close();
+	ASSERT_TRUE(reader.open(segName));
+	ASSERT_TRUE(reader.read(0x0, reinterpret_cast<hvuint8_t*>(&status), 4));
+	ASSERT_EQ(status, hvuint32_t(0x1234u));
+	// Replaced exporter does not unlink its replacement
+	shm.close();
+	reader.close();
+	ASSERT_TRUE(reader.open(segName));
+	other.close();
+	reader.close();
+	ASSERT_FALSE(reader.open(segName));
+}
+
+TEST(RegisterFileSharedMemoryTest, CorruptedSegmentTest) {
+	RegisterFile rf("RegFile", "Exported register file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Status", "", RW, 0x1234u));
+	ASSERT_TRUE(rf.createRegister(0x8, 8, "Ctrl", "", RW, 0x5u));
+
+	const std::string segName("/hvregister-corrupt-" + std::to_string(getpid()));
+	StalledSharedMemory shm(rf);
+	ASSERT_TRUE(shm.open(segName));
+	RegisterFileSharedMemoryReader reader;
+
+	// Entry table out of mapping
+	const hvuint32_t count(shm.header().registerCount);
+	shm.header().registerCount = 0x10000000u;
+	ASSERT_FALSE(reader.open(segName));
+	shm.header().registerCount = count;
+	shm.header().entrySize = sizeof(SharedMemoryEntry) - 8u;
+	ASSERT_FALSE(reader.open(segName));
+	shm.header().entrySize = sizeof(SharedMemoryEntry);
+
+	// Name and value out of mapping
+	const hvuint32_t nameLength(shm.entry(1).nameLength);
+	shm.entry(1).nameLength = 0xFFFFFFFFu;
+	ASSERT_FALSE(reader.open(segName));
+	shm.entry(1).nameLength = nameLength;
+	const hvuint64_t valueOffset(shm.entry(1).valueOffset);
+	shm.entry(1).valueOffset = ~hvuint64_t(0u);
+	ASSERT_FALSE(reader.open(segName));
+	shm.entry(1).valueOffset = valueOffset;
+	shm.entry(0).sizeInBits = 0xFFFFFFF0u;
+	ASSERT_FALSE(reader.open(segName));
+	shm.entry(0).sizeInBits = 32u;
+
+	ASSERT_TRUE(reader.open(segName));
+	ASSERT_EQ(reader.getRegisterName(1), std::string("Ctrl"));
+}
+#endif
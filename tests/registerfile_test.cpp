@@ -13,7 +13,10 @@
 #include <gtest/gtest.h>
 #include <hv/common.h>
 
+#include "registerfile/register_array.h"
 #include "registerfile/registerfile.h"
+#include "registerfile/registerfile_generator.h"
+#include "registerfile/sparse_memory_region.h"
 
 using namespace ::hv::common;
 using namespace ::hv::reg;
@@ -213,6 +216,377 @@ TEST_F(RegisterFileTest, RegisterBlockCreationTest) {
 	ASSERT_EQ(topRF.getRegisterAddress("Reg_4"), hvaddr_t(0x14));
 }
 
+TEST_F(RegisterFileTest, GeneratedMapTest) {
+	RegisterMapGeneratorConfig cfg;
+	cfg.depth = 2;
+	cfg.fanOut = 3;
+	cfg.registersPerFile = 4;
+	cfg.registerWidths = {8, 32, 64};
+	cfg.fieldDensity = 0.5;
+	cfg.callbackDensity = 0.5;
+	cfg.seed = 42u;
+	ASSERT_EQ(cfg.getRegisterFileCount(), std::size_t(13));
+	ASSERT_EQ(cfg.getRegisterCount(), std::size_t(52));
+
+	RegisterMapGenerator gen(cfg);
+	RegisterFile &root = gen.generate();
+	std::vector<hvaddr_t> addresses = gen.getAddresses();
+	ASSERT_EQ(addresses.size(), std::size_t(52));
+	ASSERT_EQ(root.getRegister(addresses.back()).getName(), std::string("RF_2_2_R3"));
+	ASSERT_GT(gen.getFieldCount(), std::size_t(0));
+	ASSERT_LT(gen.getCallbackRegisterCount(), std::size_t(52));
+
+	// Registers never overlap
+	for (std::size_t i = 1; i < addresses.size(); i++) {
+		ASSERT_GE(addresses[i], addresses[i - 1] + root.getRegister(addresses[i - 1]).getSizeInBytes());
+	}
+
+	// Same seed, same map
+	RegisterMapGenerator gen2(cfg);
+	gen2.generate();
+	ASSERT_EQ(gen2.getAddresses(), addresses);
+	ASSERT_EQ(gen2.getFieldCount(), gen.getFieldCount());
+	ASSERT_EQ(gen2.getCallbackRegisterCount(), gen.getCallbackRegisterCount());
+}
+
+TEST_F(RegisterFileTest, OccupiedSpaceTest) {
+	RegisterFile rf("RegFile", "This is a reg file", 4);
+	RegisterFile rfSub("SubRegFile", "This is a sub-reg file", 4);
+	ASSERT_TRUE(rfSub.createRegister(0x0, 32, "SubReg", "", RW));
+	ASSERT_TRUE(rfSub.createRegister(0x8, 32, "SubReg2", "", RW));
+	ASSERT_TRUE(rf.createRegister(0x8, 64, "Reg64", "", RW));
+	ASSERT_TRUE(rf.addRegisterFile(0x20, rfSub));
+	// At a register address, inside a register or inside a register file
+	ASSERT_FALSE(rf.createRegister(0x8, 32, "Reg", "", RW));
+	ASSERT_FALSE(rf.createRegister(0xC, 32, "Reg", "", RW));
+	ASSERT_FALSE(rf.createRegister(0x24, 32, "Reg", "", RW));
+	ASSERT_FALSE(rf.createRegister(0x28, 32, "Reg", "", RW));
+	// Free spaces between elements
+	ASSERT_TRUE(rf.createRegister(0x4, 32, "RegA", "", RW));
+	ASSERT_TRUE(rf.createRegister(0x10, 64, "RegB", "", RW));
+	ASSERT_TRUE(rf.createRegister(0x2C, 32, "RegC", "", RW));
+	// Each map is searched within its own largest element
+	SparseMemoryRegion sram(0x1000, "SRAM");
+	ASSERT_TRUE(rf.addRegion(0x1000, sram));
+	ASSERT_TRUE(rf.createRegister(0x2000, 32, "RegD", "", RW));
+	ASSERT_FALSE(rf.createRegister(0x1FFC, 32, "Reg", "", RW));
+	ASSERT_FALSE(rf.createRegister(0x2000, 32, "Reg", "", RW));
+	ASSERT_FALSE(rf.createRegister(0x8, 32, "Reg", "", RW));
+	ASSERT_FALSE(rf.createRegister(0x28, 32, "Reg", "", RW));
+	ASSERT_TRUE(rf.createRegister(0x2004, 32, "RegE", "", RW));
+}
+
+TEST_F(RegisterFileTest, BankedWindowTest) {
+	RegisterFile rf("RegFile", "This is a reg file", 4);
+	RegisterFile bank0("Bank0", "This is bank 0", 4);
+	RegisterFile bank1("Bank1", "This is bank 1", 4);
+	ASSERT_TRUE(bank0.createRegister(0x0, 32, "B0R0", "", RW, 0x10u));
+	ASSERT_TRUE(bank0.createRegister(0x4, 32, "B0R1", "", RW, 0x11u));
+	ASSERT_TRUE(bank1.createRegister(0x0, 32, "B1R0", "", RW, 0x20u));
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Sel", "", RW));
+	ASSERT_TRUE(rf.addBankedWindow(0x10, { &bank0, &bank1 }));
+	// Window spans largest bank
+	ASSERT_FALSE(rf.createRegister(0x14, 32, "Reg", "", RW));
+	ASSERT_TRUE(rf.createRegister(0x18, 32, "Reg", "", RW));
+	ASSERT_EQ(rf.getRegister(0x10).getName(), "B0R0");
+	ASSERT_EQ(rf.getRegister(0x14).getName(), "B0R1");
+
+	// Switching bank by API
+	hvuint64_t revision(rf.getRevision());
+	ASSERT_TRUE(rf.selectBank(0x10, 1));
+	ASSERT_GT(rf.getRevision(), revision);
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(1));
+	ASSERT_EQ(rf.getRegister(0x10).getName(), "B1R0");
+	ASSERT_EQ(rf.tryGetRegister(0x14), nullptr);
+	ASSERT_FALSE(rf.selectBank(0x10, 2));
+	ASSERT_FALSE(rf.selectBank(0x14, 0));
+
+	// Switching bank by selector register
+	ASSERT_TRUE(rf.setBankSelector(0x10, rf.getRegister(0x0)));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(0));
+	hvuint8_t sel[4] = { 0x01, 0x00, 0x00, 0x00 };
+	ASSERT_TRUE(rf.write(0x0, sel, 4));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(1));
+	sel[0] = 0x07;
+	ASSERT_TRUE(rf.write(0x0, sel, 4));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(1));
+
+	// Selection is not disconnected by callback housekeeping
+	rf.getRegister(0x0).unregisterAllCallbacks();
+	sel[0] = 0x00;
+	ASSERT_TRUE(rf.write(0x0, sel, 4));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(0));
+
+	// Setting selector again replaces previous one
+	ASSERT_TRUE(rf.setBankSelector(0x10, rf.getRegister(0x0)));
+	ASSERT_EQ(rf.getRegister(0x0).howManyBankSelectHooks(), std::size_t(1));
+	ASSERT_TRUE(rf.createRegister(0x4, 32, "SEL2", "", RW));
+	ASSERT_TRUE(rf.setBankSelector(0x10, rf.getRegister(0x4)));
+	ASSERT_EQ(rf.getRegister(0x0).howManyBankSelectHooks(), std::size_t(0));
+	sel[0] = 0x01;
+	ASSERT_TRUE(rf.write(0x0, sel, 4));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(0));
+	ASSERT_TRUE(rf.write(0x4, sel, 4));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(1));
+
+	// Detached selector does not switch bank anymore
+	ASSERT_TRUE(rf.clearBankSelector(0x10));
+	ASSERT_FALSE(rf.clearBankSelector(0x10));
+	ASSERT_EQ(rf.getRegister(0x4).howManyBankSelectHooks(), std::size_t(0));
+	sel[0] = 0x00;
+	ASSERT_TRUE(rf.write(0x4, sel, 4));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(1));
+
+	// Windows are decoded from parent register files as well
+	RegisterFile top("Top", "This is a top reg file", 4);
+	ASSERT_TRUE(top.addRegisterFile(0x100, rf));
+	ASSERT_EQ(top.getRegister(0x110).getName(), "B1R0");
+	revision = top.getRevision();
+	ASSERT_TRUE(rf.selectBank(0x10, 0));
+	ASSERT_GT(top.getRevision(), revision);
+	ASSERT_EQ(top.getRegister(0x114).getName(), "B0R1");
+	ASSERT_TRUE(top.selectBank(0x110, 1));
+	ASSERT_EQ(rf.getActiveBank(0x10), std::size_t(1));
+}
+
+TEST_F(RegisterFileTest, PatternBindingTest) {
+	RegisterFile top("Top", "This is a top reg file", 4);
+	RegisterFile uart0("uart0", "This is an UART", 4);
+	RegisterFile uart1("uart1", "This is another UART", 4);
+	ASSERT_TRUE(uart0.createRegister(0x0, 32, "INT_STATUS", "", RW));
+	ASSERT_TRUE(uart0.createRegister(0x4, 32, "INT_STATUS_RAW", "", RW));
+	ASSERT_TRUE(uart0.createRegister(0x8, 32, "DATA", "", RW));
+	ASSERT_TRUE(uart1.createRegister(0x0, 32, "INT_STATUS", "", RW));
+	ASSERT_TRUE(top.createRegister(0x0, 32, "INT_STATUS", "", RW));
+	ASSERT_TRUE(top.addRegisterFile(0x10, uart0));
+
+	// Patterns are matched against paths relative to register file
+	ASSERT_EQ(top.findRegisters(RegisterPattern("*.INT_STATUS*")),
+			std::vector<hvaddr_t>( { 0x10, 0x14 }));
+	ASSERT_EQ(top.findRegisters(RegisterPattern("INT_STATUS")),
+			std::vector<hvaddr_t>( { 0x0 }));
+	ASSERT_EQ(
+			top.findRegisters(
+					RegisterPattern("uart[0-9]\\.(DATA|INT_STATUS)",
+							RegisterPattern::REGEX)),
+			std::vector<hvaddr_t>( { 0x18, 0x10 }));
+	ASSERT_TRUE(top.findRegisters(RegisterPattern("uart?.FOO")).empty());
+
+	// Binding applies to registers inserted later
+	std::size_t calls(0u);
+	hvcbID_t id(
+			top.bindPostWriteCallback(RegisterPattern("*.INT_STATUS*"),
+					[&calls](const RegisterWriteEvent&) {calls++;}));
+	ASSERT_EQ(top.howManyBoundRegisters(id), std::size_t(2));
+	ASSERT_TRUE(top.addRegisterFile(0x20, uart1));
+	ASSERT_EQ(top.howManyBoundRegisters(id), std::size_t(3));
+	hvuint8_t buff[4] = { 0 };
+	ASSERT_TRUE(top.write(0x20, buff, 4));
+	ASSERT_TRUE(top.write(0x14, buff, 4));
+	ASSERT_TRUE(top.write(0x0, buff, 4));
+	ASSERT_TRUE(top.write(0x18, buff, 4));
+	ASSERT_EQ(calls, std::size_t(2));
+
+	// Unbinding unregisters callbacks
+	ASSERT_TRUE(top.unbindCallbacks(id));
+	ASSERT_FALSE(top.unbindCallbacks(id));
+	ASSERT_EQ(top.getRegister(0x20).howManyPostWriteCallbacks(), std::size_t(0));
+	ASSERT_TRUE(top.write(0x20, buff, 4));
+	ASSERT_EQ(calls, std::size_t(2));
+}
+
+TEST_F(RegisterFileTest, RegisterArrayTest) {
+	// 1000 16-bit elements, one every 4 bytes
+	RegisterArray lut(1000, 16, "LUT", "Lookup table", NA, 0x00FFu, 4);
+	lut.createField("Lo", 7, 0, RW);
+	lut.createField("Hi", 15, 8, RO);
+	ASSERT_EQ(lut.getSizeInBytes(), std::size_t(4000));
+	ASSERT_EQ(lut.getElementName(12), "LUT_12");
+	ASSERT_EQ(lut.getWriteMask(), hvuint64_t(0x00FFu));
+	ASSERT_EQ(lut.getValue(999), hvuint64_t(0x00FFu));
+
+	RegisterFile rf("RegFile", "This is a reg file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Ctrl", "", RW));
+	ASSERT_TRUE(rf.addRegion(0x1000, lut));
+	ASSERT_FALSE(rf.createRegister(0x1F9C, 32, "Overlap", "", RW));
+	ASSERT_TRUE(rf.createRegister(0x1FA0, 32, "After", "", RW));
+	ASSERT_EQ(&rf.getRegion("LUT"), &lut);
+	hvaddr_t offset(0u);
+	ASSERT_EQ(rf.tryGetRegion(0x100A, &offset), &lut);
+	ASSERT_EQ(offset, hvaddr_t(0xA));
+	ASSERT_EQ(rf.tryGetRegion(0x0), nullptr);
+
+	// Element accesses apply layout masks, padding reads as zero
+	hvuint32_t value(0x1234u);
+	ASSERT_TRUE(rf.write(0x1008, reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(lut.getValue(2), hvuint64_t(0x0034u));
+	ASSERT_EQ(lut.getFieldValue(2, "Lo"), hvuint64_t(0x34u));
+	lut.setFieldValue(2, "Hi", 0xABu);
+	hvuint32_t burst[2] = { 0xFFFFFFFFu, 0xFFFFFFFFu };
+	ASSERT_TRUE(rf.read(0x1004, reinterpret_cast<hvuint8_t*>(burst), 8));
+	ASSERT_EQ(burst[0], hvuint32_t(0x00FFu));
+	ASSERT_EQ(burst[1], hvuint32_t(0xAB34u));
+
+	// Element-indexed callbacks
+	std::vector<std::size_t> written;
+	lut.registerCallback(ARRAY_POST_WRITE,
+			[&written](const RegisterArrayEvent &ev) {
+				written.push_back(ev.index);
+				return true;
+			}, 10, 19);
+	hvcbID_t vetoId = lut.registerCallback(ARRAY_PRE_WRITE,
+			[](const RegisterArrayEvent &ev) {return ev.index != 15;});
+	ASSERT_TRUE(lut.writeElement(9, 0x1u));
+	ASSERT_TRUE(lut.writeElement(10, 0x2u));
+	ASSERT_FALSE(lut.writeElement(15, 0x3u));
+	ASSERT_EQ(lut.getValue(15), hvuint64_t(0x00FFu));
+	ASSERT_EQ(written, std::vector<std::size_t>( { 10 }));
+	ASSERT_TRUE(lut.unregisterCallback(vetoId));
+	ASSERT_FALSE(lut.unregisterCallback(vetoId));
+	ASSERT_EQ(lut.howManyCallbacks(), std::size_t(1));
+
+	// Arrays are decoded from parent register files as well
+	RegisterFile top("Top", "This is a top reg file", 4);
+	ASSERT_TRUE(top.addRegisterFile(0x10000, rf));
+	ASSERT_EQ(top.getRegionAddress("LUT"), hvaddr_t(0x11000));
+	value = 0u;
+	ASSERT_TRUE(top.read(0x11008, reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(value, hvuint32_t(0xAB34u));
+	lut.reset();
+	ASSERT_EQ(lut.getValue(2), hvuint64_t(0x00FFu));
+}
+
+TEST_F(RegisterFileTest, SparseMemoryRegionTest) {
+	// 1 MiB window, 4 KiB pages, unwritten bytes read as 0xA5
+	SparseMemoryRegion sram(0x100000, "SRAM", "Shared SRAM", 0x1000, 0xA5u);
+	RegisterFile rf("RegFile", "This is a reg file", 4);
+	ASSERT_TRUE(rf.createRegister(0x0, 32, "Ctrl", "", RW));
+	ASSERT_TRUE(rf.addRegion(0x100000, sram));
+	ASSERT_FALSE(rf.addRegion(0x180000, sram));
+	ASSERT_EQ(sram.getAllocatedPageCount(), std::size_t(0));
+
+	// Reads do not allocate pages
+	hvuint32_t value(0u);
+	ASSERT_TRUE(rf.read(0x1FFFFC, reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(value, hvuint32_t(0xA5A5A5A5u));
+	ASSERT_EQ(sram.getAllocatedPageCount(), std::size_t(0));
+
+	// Writes crossing a page boundary allocate both pages
+	hvuint32_t burst[2] = { 0x11111111u, 0x22222222u };
+	ASSERT_TRUE(rf.write(0x100FFC, reinterpret_cast<hvuint8_t*>(burst), 8));
+	ASSERT_EQ(sram.getAllocatedPageCount(), std::size_t(2));
+	ASSERT_TRUE(rf.read(0x101000, reinterpret_cast<hvuint8_t*>(&value), 4));
+	ASSERT_EQ(value, hvuint32_t(0x22222222u));
+
+	// Snapshots only hold allocated pages
+	SparseMemoryRegion::Snapshot snap(sram.takeSnapshot());
+	ASSERT_EQ(snap.pages.size(), std::size_t(2));
+	value = 0xDEADBEEFu;
+	sram.debugWrite(0x1000, reinterpret_cast<hvuint8_t*>(&value), 4);
+	sram.debugWrite(0x80000, reinterpret_cast<hvuint8_t*>(&value), 4);
+	ASSERT_EQ(sram.getAllocatedPageCount(), std::size_t(3));
+	ASSERT_TRUE(sram.restoreSnapshot(snap));
+	ASSERT_EQ(sram.getAllocatedPageCount(), std::size_t(2));
+	sram.debugRead(0x1000, reinterpret_cast<hvuint8_t*>(&value), 4);
+	ASSERT_EQ(value, hvuint32_t(0x22222222u));
+	sram.debugRead(0x80000, reinterpret_cast<hvuint8_t*>(&value), 4);
+	ASSERT_EQ(value, hvuint32_t(0xA5A5A5A5u));
+	SparseMemoryRegion small(0x100, "Small", "", 0x40);
+	ASSERT_FALSE(small.restoreSnapshot(snap));
+
+	sram.clear();
+	ASSERT_EQ(sram.getAllocatedPageCount(), std::size_t(0));
+	sram.debugRead(0xFFC, reinterpret_cast<hvuint8_t*>(&value), 4);
+	ASSERT_EQ(value, hvuint32_t(0xA5A5A5A5u));
+}
+
+#ifndef HV_REG_DISABLE_STATISTICS
+TEST_F(RegisterFileTest, AccessStatisticsTest) {
+	RegisterFile topRF("RegFile", "This is a reg file", 4);
+	RegisterFile subRF("SubRegFile", "This is a sub reg file", 4);
+	ASSERT_TRUE(subRF.createRegister(0x0, 32, "SubReg", "", RW));
+	ASSERT_TRUE(topRF.addRegisterFile(0x10, subRF));
+	ASSERT_TRUE(topRF.createRegister(0x0, 32, "Reg0", "", RW));
+	ASSERT_EQ(topRF.getAccessStatistics(0x0), nullptr);
+
+	topRF.enableAccessStatistics();
+	ASSERT_TRUE(topRF.isAccessStatisticsEnabled());
+	// Registers inserted after activation are counted too
+	ASSERT_TRUE(topRF.createRegister(0x4, 16, "Reg1", "", RW));
+
+	hvuint8_t buff[4] = { 0 };
+	ASSERT_TRUE(topRF.write(0x0, buff, 4));
+	ASSERT_TRUE(topRF.read(0x0, buff, 4));
+	ASSERT_TRUE(topRF.read(0x0, buff, 2));
+	ASSERT_TRUE(topRF.read(0x10, buff, 4));
+	topRF.getRegister(0x4).registerPreWriteCallback(
+			[](const RegisterWriteEvent&) {return false;});
+	ASSERT_FALSE(topRF.write(0x4, buff, 2));
+
+	const RegisterAccessCounters *c0 = topRF.getAccessStatistics(0x0);
+	ASSERT_NE(c0, nullptr);
+	ASSERT_EQ(c0->reads, hvuint64_t(2));
+	ASSERT_EQ(c0->writes, hvuint64_t(1));
+	ASSERT_EQ(c0->bytesRead, hvuint64_t(6));
+	ASSERT_EQ(c0->bytesWritten, hvuint64_t(4));
+	ASSERT_EQ(topRF.getAccessStatistics(0x4)->writeVetoes, hvuint64_t(1));
+	ASSERT_EQ(topRF.getAccessStatistics(0x4)->writes, hvuint64_t(0));
+
+	std::vector<std::pair<hvaddr_t, RegisterAccessCounters> > hottest =
+			topRF.getHottestRegisters(2);
+	ASSERT_EQ(hottest.size(), std::size_t(2));
+	ASSERT_EQ(hottest[0].first, hvaddr_t(0x0));
+	ASSERT_FALSE(topRF.getAccessStatisticsReport().empty());
+
+	topRF.resetAccessStatistics();
+	ASSERT_EQ(topRF.getAccessStatistics(0x0)->reads, hvuint64_t(0));
+	ASSERT_TRUE(topRF.getHottestRegisters(10).empty());
+
+	topRF.disableAccessStatistics();
+	ASSERT_EQ(topRF.getAccessStatistics(0x10), nullptr);
+
+	// Counters of a child register file are shared, not replaced
+	subRF.enableAccessStatistics();
+	topRF.enableAccessStatistics();
+	ASSERT_EQ(topRF.getAccessStatistics(0x10), subRF.getAccessStatistics(0x0));
+	ASSERT_TRUE(topRF.read(0x10, buff, 4));
+	ASSERT_EQ(subRF.getAccessStatistics(0x0)->reads, hvuint64_t(1));
+	topRF.resetAccessStatistics();
+	ASSERT_EQ(subRF.getAccessStatistics(0x0)->reads, hvuint64_t(1));
+	topRF.disableAccessStatistics();
+	ASSERT_NE(subRF.getAccessStatistics(0x0), nullptr);
+	subRF.disableAccessStatistics();
+	ASSERT_EQ(topRF.getAccessStatistics(0x10), nullptr);
+}
+
+TEST_F(RegisterFileTest, AccessStatisticsLifetimeTest) {
+	hvuint8_t buff[4] = { 0 };
+	// Register outliving register file keeps its counters
+	Register reg(32, "Reg", "", RW);
+	{
+		RegisterFile rf("RegFile", "This is a reg file", 4);
+		ASSERT_TRUE(rf.addRegister(0x0, reg));
+		rf.enableAccessStatistics();
+		ASSERT_TRUE(rf.write(0x0, buff, 4));
+	}
+	ASSERT_TRUE(reg.write(buff, 4));
+	ASSERT_TRUE(reg.read(buff, 4));
+	ASSERT_NE(reg.getAccessCounters(), nullptr);
+	ASSERT_EQ(reg.getAccessCounters()->writes, hvuint64_t(2));
+	ASSERT_EQ(reg.getAccessCounters()->reads, hvuint64_t(1));
+
+	// Register file outliving its registers
+	RegisterFile rf("RegFile", "This is a reg file", 4);
+	rf.enableAccessStatistics();
+	{
+		Register tmp(32, "Tmp", "", RW);
+		ASSERT_TRUE(rf.addRegister(0x0, tmp));
+		ASSERT_TRUE(tmp.write(buff, 4));
+	}
+	rf.resetAccessStatistics();
+}
+#endif
+
 //TEST(RegisterFileTest, StartingUpGuideTest) {
 //	// Top register file creation
 //	RegisterFile topRF("Top Register File", "This is the top register file", 4);
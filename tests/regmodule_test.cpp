@@ -6,8 +6,12 @@
  *
  * @brief Register-style module
  */
+#include <cstring>
 #include <iostream>
 #include <regmodule/reg_module.h>
+#include <registerfile/register_array.h>
+#include <registerfile/sparse_memory_region.h>
+#include <trace/access_trace_replayer.h>
 #include <gtest/gtest.h>
 #include <systemc>
 
@@ -275,3 +279,1057 @@ TEST_F(RegModuleTest, AlignmentRWTest2) {
     ::sc_core::sc_start();
 }
 
+
+TEST_F(RegModuleTest, TraceReplayTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+    const char *traceFile = "regmodule_trace_test.hvtrace";
+
+    SomeRegModuleClass rm("RegModuleRecorded", 4, 16);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    AccessTraceRecorder rec;
+    ASSERT_TRUE(rec.open(traceFile));
+    rm.setTraceRecorder(&rec);
+
+    hvuint8_t tmp[12] = {0x01, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x05, 0x06, 0x00, 0x00};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x00);
+    txn.setDataPtr(tmp);
+    txn.setDataLength(12);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    txn.setDataLength(8);
+    mod.socket->b_transport(txn, zeroTime);
+    txn.setAddress(0x04);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    rm.setTraceRecorder(nullptr);
+    rec.close();
+    // One record per transaction
+    ASSERT_EQ(rec.getRecordCount(), hvuint64_t(3));
+
+    AccessTraceReplayer replayer;
+    ASSERT_TRUE(replayer.load(traceFile));
+    std::remove(traceFile);
+    SomeRegModuleClass rmReplay("RegModuleReplayed", 4, 16);
+    FooMMModule modReplay("MyFooModuleReplay");
+    modReplay.socket.bind(rmReplay.memMapSocket);
+    AccessTraceReplayResult res = replayer.replay(modReplay.socket);
+    ASSERT_TRUE(res.isMatching());
+    ASSERT_EQ(res.writes, hvuint64_t(1));
+    ASSERT_EQ(res.reads, hvuint64_t(1));
+    ASSERT_EQ(hvuint16_t(rmReplay.getMainRegFile().getRegister(0x04)), hvuint16_t(0x0403));
+    // Only the first 8 bytes of an access are recorded: larger writes are skipped
+    ASSERT_EQ(res.skipped, hvuint64_t(1));
+    ASSERT_EQ(hvuint16_t(rmReplay.getMainRegFile().getRegister(0x08)), hvuint16_t(0x0));
+
+    ::sc_core::sc_start();
+}
+
+class DmiInitiator : public ::hv::module::Module {
+  public:
+    DmiInitiator(::hv::module::ModuleName name_) : ::hv::module::Module(name_) {
+        socket.registerInvalidateDirectMemPtr(this, &DmiInitiator::invalidateCb);
+    }
+
+    void invalidateCb(::sc_dt::uint64 start, ::sc_dt::uint64 end) {
+        invalidations.push_back(std::make_pair(start, end));
+    }
+
+    ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedSimpleInitiatorSocket<> socket;
+    std::vector<std::pair<::sc_dt::uint64, ::sc_dt::uint64>> invalidations;
+};
+
+TEST_F(RegModuleTest, DirectMemoryAccessTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleDMI", 4, 32);
+    DmiInitiator mod("MyDmiInitiator");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterFile &rf = rm.getMainRegFile();
+    rf.getRegister(0x08).createField("Status", 15, 8, RW);
+
+    // Three contiguous callback-free registers are granted at once
+    MemoryMappedPayload<hvaddr_t> txn;
+    ::tlm::tlm_dmi dmi;
+    txn.setAddress(0x04);
+    ASSERT_TRUE(mod.socket->get_direct_mem_ptr(txn, dmi));
+    ASSERT_EQ(dmi.get_start_address(), ::sc_dt::uint64(0x0));
+    ASSERT_EQ(dmi.get_end_address(), ::sc_dt::uint64(0xB));
+    ASSERT_TRUE(dmi.is_read_allowed());
+    ASSERT_FALSE(dmi.is_write_allowed());
+    const hvuint8_t *image = dmi.get_dmi_ptr();
+
+    // Image follows transport writes and model modifications
+    hvuint8_t tmp[4] = {0x44, 0x33, 0x22, 0x11};
+    txn.setDataPtr(tmp);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(image[4], hvuint8_t(0x44));
+    ASSERT_EQ(image[7], hvuint8_t(0x11));
+    rf.getRegister(0x08) = hvuint32_t(0xCAFE);
+    ASSERT_EQ(image[8], hvuint8_t(0xFE));
+    ASSERT_EQ(image[9], hvuint8_t(0xCA));
+    // Selection writes of model code update image as well
+    rf.getRegister(0x08).selectField("Status") = 0xAB;
+    ASSERT_EQ(image[9], hvuint8_t(0xAB));
+    ASSERT_EQ(image[8], hvuint8_t(0xFE));
+    rf.getRegister(0x08).select(0) = 0;
+    ASSERT_EQ(image[8], hvuint8_t(0xFE));
+    rf.getRegister(0x08).select(31) = 1;
+    ASSERT_EQ(image[11], hvuint8_t(0x80));
+    // Plain BitVector selections are followed once notified
+    rf.getRegister(0x08)[0] = 1;
+    rf.getRegister(0x08).notifyValueChange();
+    ASSERT_EQ(image[8], hvuint8_t(0xFF));
+
+    // Registering a callback invalidates the register range
+    rf.getRegister(0x08).registerPostReadCallback([](const RegisterReadEvent &) {});
+    ASSERT_EQ(mod.invalidations.size(), std::size_t(1));
+    ASSERT_EQ(mod.invalidations[0].first, ::sc_dt::uint64(0x8));
+    ASSERT_EQ(mod.invalidations[0].second, ::sc_dt::uint64(0xB));
+    txn.setAddress(0x08);
+    ASSERT_FALSE(mod.socket->get_direct_mem_ptr(txn, dmi));
+    txn.setAddress(0x00);
+    ASSERT_TRUE(mod.socket->get_direct_mem_ptr(txn, dmi));
+    ASSERT_EQ(dmi.get_end_address(), ::sc_dt::uint64(0x7));
+
+    // Disabling DMI invalidates everything
+    rm.enableDirectMemoryAccess(false);
+    ASSERT_EQ(mod.invalidations.size(), std::size_t(2));
+    ASSERT_FALSE(mod.socket->get_direct_mem_ptr(txn, dmi));
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, DecodeCacheTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleDecodeCache", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+
+    // Polling the same register only decodes it once
+    hvuint8_t tmp[8] = {0};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x04);
+    txn.setDataPtr(tmp);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    for (int i = 0; i < 10; i++) {
+        mod.socket->b_transport(txn, zeroTime);
+    }
+    ASSERT_EQ(rm.getDecodeCacheMisses(), hvuint64_t(1));
+    ASSERT_EQ(rm.getDecodeCacheHits(), hvuint64_t(9));
+
+    // Transactions spanning several registers use one entry per register
+    txn.setAddress(0x04);
+    txn.setDataLength(8);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(rm.getDecodeCacheMisses(), hvuint64_t(2));
+    ASSERT_EQ(rm.getDecodeCacheHits(), hvuint64_t(10));
+
+    // Cache is flushed when layout changes
+    Register reg4(32, "reg4", "Register 4", RW, 0xA5u);
+    ASSERT_TRUE(rm.addRegister(0x0C, reg4));
+    txn.setAddress(0x08);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(rm.getDecodeCacheMisses(), hvuint64_t(4));
+    ASSERT_EQ(tmp[4], hvuint8_t(0xA5));
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, DecodeCacheSlotTest) {
+    // Unaligned register file of 32-bit registers: all cache entries are used
+    RegisterFile rf("RegFile", "This is a reg file", 0);
+    for (hvaddr_t addr = 0x0; addr < 0x40; addr += 4) {
+        ASSERT_TRUE(rf.createRegister(addr, 32, "Reg" + std::to_string(addr), "", RW));
+    }
+    AddressDecoder decoder(rf);
+    for (int i = 0; i < 2; i++) {
+        for (hvaddr_t addr = 0x0; addr < 0x40; addr += 4) {
+            ASSERT_EQ(decoder.lookup(addr).reg, &rf.getRegister(addr));
+        }
+    }
+    ASSERT_EQ(decoder.getMisses(), hvuint64_t(16));
+    ASSERT_EQ(decoder.getHits(), hvuint64_t(16));
+}
+
+TEST_F(RegModuleTest, TransportDbgTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+
+    SomeRegModuleClass rm("RegModuleDebug", 4, 16);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterFile &rf = rm.getMainRegFile();
+    rf.getRegister(0x00) = hvuint16_t(0x0201);
+    rf.getRegister(0x04) = hvuint16_t(0x0403);
+    rf.getRegister(0x08) = hvuint16_t(0x0605);
+    int callbackCalls(0);
+    rf.getRegister(0x04).registerPreReadCallback([&callbackCalls](const RegisterReadEvent &) {
+        callbackCalls++;
+        return false;
+    });
+    rf.getRegister(0x04).registerPreWriteCallback([&callbackCalls](const RegisterWriteEvent &) {
+        callbackCalls++;
+        return false;
+    });
+
+    // Burst read bypasses vetoing callbacks, padding is read as zeros
+    hvuint8_t tmp[12];
+    std::memset(tmp, 0xFF, sizeof(tmp));
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x00);
+    txn.setDataPtr(tmp);
+    txn.setDataLength(12);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 12u);
+    hvuint8_t expected[12] = {0x01, 0x02, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x05, 0x06, 0x00, 0x00};
+    ASSERT_EQ(std::memcmp(tmp, expected, sizeof(tmp)), 0);
+
+    // Write goes directly to register storage
+    hvuint8_t wr[2] = {0xCD, 0xAB};
+    txn.setAddress(0x04);
+    txn.setDataPtr(wr);
+    txn.setDataLength(2);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 2u);
+    ASSERT_EQ(hvuint16_t(rf.getRegister(0x04)), hvuint16_t(0xABCD));
+    ASSERT_EQ(callbackCalls, 0);
+
+    // Transfer stops where no register is mapped
+    txn.setAddress(0x08);
+    txn.setDataPtr(tmp);
+    txn.setDataLength(12);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 4u);
+    txn.setAddress(0x40);
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 0u);
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, HolePolicyTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleHoles", 4, 16);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    rm.getMainRegFile().getRegister(0x08) = hvuint16_t(0x0605);
+
+    hvuint8_t tmp[8];
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x08);
+    txn.setDataPtr(tmp);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+
+    // Stray accesses get an address error instead of stopping simulation
+    ASSERT_EQ(rm.getHolePolicy(), RegModule<>::HOLE_ADDRESS_ERROR);
+    txn.setAddress(0x40);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_ADDRESS_ERROR_RESPONSE);
+    const hvuint64_t misses(rm.getDecodeCacheMisses());
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_ADDRESS_ERROR_RESPONSE);
+    // Misses are cached too
+    ASSERT_EQ(rm.getDecodeCacheMisses(), misses);
+    // Burst running past last register
+    txn.setAddress(0x08);
+    txn.setDataLength(8);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_ADDRESS_ERROR_RESPONSE);
+
+    // Read-as-zero, write-ignored
+    rm.setHolePolicy(RegModule<>::HOLE_RAZ_WI);
+    std::memset(tmp, 0xFF, sizeof(tmp));
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    hvuint8_t expected[8] = {0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    ASSERT_EQ(std::memcmp(tmp, expected, sizeof(tmp)), 0);
+    // Unaligned hole ends at next aligned address
+    txn.setAddress(0x06);
+    std::memset(tmp, 0xFF, sizeof(tmp));
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    hvuint8_t unaligned[8] = {0x00, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00};
+    ASSERT_EQ(std::memcmp(tmp, unaligned, sizeof(tmp)), 0);
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 8u);
+    ASSERT_EQ(std::memcmp(tmp, unaligned, sizeof(tmp)), 0);
+    // Access starting inside a register is not a hole
+    txn.setAddress(0x09);
+    txn.setDataLength(2);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_ADDRESS_ERROR_RESPONSE);
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 0u);
+    txn.setAddress(0x40);
+    txn.setDataLength(8);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, WordTransportTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleWord", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    Register &reg = rm.getMainRegFile().getRegister(0x04);
+    reg.setWriteMask(BitVector(32, 0x00FFFF00u));
+    reg = hvuint32_t(0x11223344u);
+
+    // Single-word write and read apply masks as the generic path does
+    hvuint8_t tmp[4] = {0xDD, 0xCC, 0xBB, 0xAA};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x04);
+    txn.setDataPtr(tmp);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(hvuint32_t(reg), hvuint32_t(0x11BBCC44u));
+    reg.setReadMask(BitVector(32, 0x0000FFFFu));
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(tmp[0], hvuint8_t(0x44));
+    ASSERT_EQ(tmp[1], hvuint8_t(0xCC));
+    ASSERT_EQ(tmp[2], hvuint8_t(0x00));
+    ASSERT_EQ(tmp[3], hvuint8_t(0x00));
+
+    // Callbacks still run and can veto
+    reg.registerPreReadCallback([](const RegisterReadEvent &) { return false; });
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_GENERIC_ERROR_RESPONSE);
+
+    ::sc_core::sc_start();
+}
+
+class NbInitiator : public ::hv::module::Module {
+  public:
+    SC_HAS_PROCESS(NbInitiator);
+    NbInitiator(::hv::module::ModuleName name_) : ::hv::module::Module(name_) {
+        socket.registerNBTransportBw(this, &NbInitiator::nbTransportBwCb);
+        SC_THREAD(run);
+    }
+
+    // Three pipelined requests: write 0x0, write 0x4, read 0x0
+    void run() {
+        txns[0].setAddress(0x00);
+        txns[0].setCommand(MEM_MAP_WRITE_COMMAND);
+        txns[1].setAddress(0x04);
+        txns[1].setCommand(MEM_MAP_WRITE_COMMAND);
+        txns[2].setAddress(0x00);
+        txns[2].setCommand(MEM_MAP_READ_COMMAND);
+        data[0] = 0x11223344u;
+        data[1] = 0x55667788u;
+        data[2] = 0u;
+        for (int i = 0; i < 3; i++) {
+            txns[i].setDataPtr(reinterpret_cast<hvuint8_t *>(&data[i]));
+            txns[i].setDataLength(4);
+            ::tlm::tlm_phase phase(::tlm::BEGIN_REQ);
+            ::sc_core::sc_time delay(1, ::sc_core::SC_NS);
+            requestStatus.push_back(socket->nb_transport_fw(txns[i], phase, delay));
+            requestPhases.push_back(phase);
+        }
+    }
+
+    ::tlm::tlm_sync_enum nbTransportBwCb(MemoryMappedPayload<hvaddr_t> &txn, ::tlm::tlm_phase &phase,
+                                         ::sc_core::sc_time &) {
+        if (phase == ::tlm::BEGIN_RESP) {
+            responses.push_back(&txn);
+            responseTimes.push_back(::sc_core::sc_time_stamp());
+        }
+        return ::tlm::TLM_COMPLETED;
+    }
+
+    ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedSimpleInitiatorSocket<> socket;
+    MemoryMappedPayload<hvaddr_t> txns[3];
+    hvuint32_t data[3];
+    std::vector<::tlm::tlm_sync_enum> requestStatus;
+    std::vector<::tlm::tlm_phase> requestPhases;
+    std::vector<MemoryMappedPayload<hvaddr_t> *> responses;
+    std::vector<::sc_core::sc_time> responseTimes;
+};
+
+TEST_F(RegModuleTest, NbTransportTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+
+    SomeRegModuleClass rm("RegModuleNb", 4, 32);
+    NbInitiator mod("MyNbInitiator");
+    mod.socket.bind(rm.memMapSocket);
+
+    ::sc_core::sc_start();
+
+    // All requests accepted at once
+    ASSERT_EQ(mod.requestStatus.size(), std::size_t(3));
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(mod.requestStatus[i], ::tlm::TLM_UPDATED);
+        ASSERT_EQ(mod.requestPhases[i], ::tlm::END_REQ);
+    }
+    // Responses in request order, at request time
+    ASSERT_EQ(mod.responses.size(), std::size_t(3));
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(mod.responses[i], &mod.txns[i]);
+        ASSERT_EQ(mod.txns[i].getResponseStatus(), MEM_MAP_OK_RESPONSE);
+        ASSERT_EQ(mod.responseTimes[i], ::sc_core::sc_time(1, ::sc_core::SC_NS));
+    }
+    ASSERT_EQ(hvuint32_t(rm.getMainRegFile().getRegister(0x04)), hvuint32_t(0x55667788u));
+    ASSERT_EQ(mod.data[2], hvuint32_t(0x11223344u));
+}
+
+TEST_F(RegModuleTest, AccessLatencyTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    const ::sc_core::sc_time ns(1, ::sc_core::SC_NS);
+
+    SomeRegModuleClass rm("RegModuleLatency", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    rm.setAccessLatency(ns * 1, ns * 2);
+    rm.setRangeAccessLatency(0x04, 0x0B, ns * 10, ns * 20);
+    rm.setRegisterAccessLatency(0x08, ns * 100, ns * 200);
+    ASSERT_EQ(rm.getAccessLatency(0x00).read, ns * 1);
+    ASSERT_EQ(rm.getAccessLatency(0x04).write, ns * 20);
+    ASSERT_EQ(rm.getAccessLatency(0x08).read, ns * 100);
+
+    // Single-word path
+    hvuint8_t tmp[12] = {0};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x04);
+    txn.setDataPtr(tmp);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    ::sc_core::sc_time delay(ns * 5);
+    mod.socket->b_transport(txn, delay);
+    ASSERT_EQ(delay, ns * 15);
+
+    // Bursts accumulate latency of each register, callbacks see local time
+    ::sc_core::sc_time callbackTime;
+    rm.getMainRegFile().getRegister(0x08).registerPreWriteCallback(
+        [&rm, &callbackTime](const RegisterWriteEvent &) {
+            callbackTime = rm.getAccessTime();
+            return true;
+        });
+    txn.setAddress(0x00);
+    txn.setDataLength(12);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    delay = ::sc_core::SC_ZERO_TIME;
+    mod.socket->b_transport(txn, delay);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(delay, ns * 222);
+    ASSERT_EQ(callbackTime, ns * 22);
+    ASSERT_EQ(rm.getAccessTime(), ::sc_core::SC_ZERO_TIME);
+
+    // Latency changes apply to decoded addresses
+    rm.clearAccessLatencies();
+    delay = ::sc_core::SC_ZERO_TIME;
+    mod.socket->b_transport(txn, delay);
+    ASSERT_EQ(delay, ::sc_core::SC_ZERO_TIME);
+
+    ::sc_core::sc_start();
+}
+
+class QuantumInitiator : public ::hv::module::Module {
+  public:
+    SC_HAS_PROCESS(QuantumInitiator);
+    QuantumInitiator(::hv::module::ModuleName name_) : ::hv::module::Module(name_) {
+        SC_THREAD(run);
+    }
+
+    // Four reads of 0x0 with 3 ns latency each
+    void run() {
+        hvuint32_t data;
+        MemoryMappedPayload<hvaddr_t> txn;
+        txn.setAddress(0x00);
+        txn.setDataPtr(reinterpret_cast<hvuint8_t *>(&data));
+        txn.setDataLength(4);
+        txn.setCommand(MEM_MAP_READ_COMMAND);
+        ::sc_core::sc_time delay(::sc_core::SC_ZERO_TIME);
+        for (int i = 0; i < 4; i++) {
+            socket->b_transport(txn, delay);
+            delays.push_back(delay);
+            times.push_back(::sc_core::sc_time_stamp());
+        }
+    }
+
+    ::hv::communication::tlm2::protocols::memorymapped::MemoryMappedSimpleInitiatorSocket<> socket;
+    std::vector<::sc_core::sc_time> delays, times;
+};
+
+TEST_F(RegModuleTest, QuantumSyncTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    const ::sc_core::sc_time ns(1, ::sc_core::SC_NS);
+    ::tlm::tlm_global_quantum::instance().set(ns * 5);
+
+    SomeRegModuleClass rm("RegModuleQuantum", 4, 32);
+    QuantumInitiator mod("MyQuantumInitiator");
+    mod.socket.bind(rm.memMapSocket);
+    rm.setAccessLatency(ns * 3, ns * 3);
+    rm.enableQuantumSync();
+
+    ::sc_core::sc_start();
+
+    // Module synchronizes once annotated delay reaches the quantum
+    ASSERT_EQ(mod.delays.size(), std::size_t(4));
+    ASSERT_EQ(mod.delays[0], ns * 3);
+    ASSERT_EQ(mod.times[0], ::sc_core::SC_ZERO_TIME);
+    ASSERT_EQ(mod.delays[1], ::sc_core::SC_ZERO_TIME);
+    ASSERT_EQ(mod.times[1], ns * 6);
+    ASSERT_EQ(mod.delays[2], ns * 3);
+    ASSERT_EQ(mod.delays[3], ::sc_core::SC_ZERO_TIME);
+    ASSERT_EQ(mod.times[3], ns * 12);
+    ::tlm::tlm_global_quantum::instance().set(::sc_core::SC_ZERO_TIME);
+}
+
+class AliasedRegModule : public SomeRegModuleClass {
+  public:
+    AliasedRegModule(ModuleName name_) : SomeRegModuleClass(name_, 4, 32) {
+        RegisterFile &cfg = addAddressSpace("config", 4).getRegisterFile();
+        cfg.addRegister(0x100, reg2);
+        cfg.addRegister(0x104, reg1);
+    }
+};
+
+TEST_F(RegModuleTest, AddressSpaceTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    AliasedRegModule rm("RegModuleSpaces");
+    FooMMModule mod("MyFooModule");
+    FooMMModule cfgMod("MyCfgModule");
+    mod.socket.bind(rm.memMapSocket);
+    ASSERT_TRUE(rm.hasAddressSpace("config"));
+    ASSERT_FALSE(rm.hasAddressSpace("data"));
+    RegModule<>::AddressSpace &cfg = rm.getAddressSpace("config");
+    cfgMod.socket.bind(cfg.socket);
+
+    // Same register state seen at different addresses
+    hvuint32_t data(0x12345678u);
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x100);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(&data));
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    cfgMod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(hvuint32_t(rm.getMainRegFile().getRegister(0x04)), hvuint32_t(0x12345678u));
+    data = 0u;
+    txn.setAddress(0x04);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(data, hvuint32_t(0x12345678u));
+
+    // Each address space decodes its own layout with its own cache
+    txn.setAddress(0x08);
+    cfgMod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_ADDRESS_ERROR_RESPONSE);
+    ASSERT_EQ(cfg.getDecoder().getMisses(), hvuint64_t(2));
+    ASSERT_EQ(rm.getDecodeCacheMisses(), hvuint64_t(1));
+
+    // Latencies and debug transport per address space
+    cfg.getDecoder().setAccessLatency(::sc_core::sc_time(7, ::sc_core::SC_NS),
+                                      ::sc_core::sc_time(7, ::sc_core::SC_NS));
+    ::sc_core::sc_time delay(::sc_core::SC_ZERO_TIME);
+    txn.setAddress(0x104);
+    cfgMod.socket->b_transport(txn, delay);
+    ASSERT_EQ(delay, ::sc_core::sc_time(7, ::sc_core::SC_NS));
+    hvuint8_t burst[8];
+    txn.setAddress(0x100);
+    txn.setDataPtr(burst);
+    txn.setDataLength(8);
+    ASSERT_EQ(cfgMod.socket->transport_dbg(txn), 8u);
+    ASSERT_EQ(burst[0], hvuint8_t(0x78));
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, AccessPermissionTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModulePermissions", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterFile &rf = rm.getMainRegFile();
+    ASSERT_TRUE(rf.addAccessRule(0x04, 0x07, AccessPermission::secureOnly()));
+    ASSERT_TRUE(rf.addAccessRule(0x08, 0x0B, AccessPermission::readOnlyFor(hvuint64_t(1u) << 2)));
+    AccessAttributes attributes(3u, false, false);
+    rm.setAccessAttributesExtractor(
+        [&attributes](const MemoryMappedPayload<hvaddr_t> &) { return attributes; });
+    rf.getRegister(0x04) = hvuint32_t(0xCAFEu);
+
+    // Non-secure accesses to secure register, single-word and burst
+    hvuint32_t data[3] = {0u, 0u, 0u};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x04);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(data));
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_GENERIC_ERROR_RESPONSE);
+    ASSERT_EQ(data[0], hvuint32_t(0u));
+    txn.setAddress(0x00);
+    txn.setDataLength(12);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_GENERIC_ERROR_RESPONSE);
+    attributes.secure = true;
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(data[1], hvuint32_t(0xCAFEu));
+
+    // Register writable by initiator 2 only
+    txn.setAddress(0x08);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_GENERIC_ERROR_RESPONSE);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    attributes.initiatorId = 2u;
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+
+    // Unprotected registers are not checked
+    attributes.initiatorId = 100u;
+    txn.setAddress(0x00);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, RangeCallbackTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleRangeCallbacks", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterFile &rf = rm.getMainRegFile();
+    std::vector<hvaddr_t> offsets;
+    hvuint32_t lastWrite(0u);
+    bool veto(false);
+    rf.registerRangeCallback(0x04, 0x0B, RANGE_PRE_WRITE,
+                             [&veto](const RangeAccessEvent &) { return !veto; });
+    hvcbID_t postId(rf.registerRangeCallback(
+        0x04, 0x0B, RANGE_POST_WRITE, [&](const RangeAccessEvent &event) {
+            offsets.push_back(event.offset);
+            ::std::memcpy(&lastWrite, event.data, event.size);
+            return true;
+        }));
+
+    // Single-word write goes through callbacks
+    hvuint32_t data[3] = {0x11u, 0x22u, 0x33u};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x04);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(data));
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(offsets.size(), std::size_t(1u));
+    ASSERT_EQ(offsets[0], hvaddr_t(0u));
+    ASSERT_EQ(lastWrite, hvuint32_t(0x11u));
+
+    // Burst write, callbacks only called on covered registers
+    txn.setAddress(0x00);
+    txn.setDataLength(12);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(offsets.size(), std::size_t(3u));
+    ASSERT_EQ(offsets[2], hvaddr_t(4u));
+    ASSERT_EQ(lastWrite, hvuint32_t(0x33u));
+
+    // Vetoed write leaves register unchanged
+    veto = true;
+    data[0] = 0x44u;
+    txn.setAddress(0x08);
+    txn.setDataLength(4);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_GENERIC_ERROR_RESPONSE);
+    ASSERT_EQ(hvuint32_t(rf.getRegister(0x08).getValue()), hvuint32_t(0x33u));
+    hvuint32_t value(0x55u);
+    ASSERT_FALSE(rf.write(0x08, reinterpret_cast<hvuint8_t *>(&value), 4));
+    veto = false;
+    ASSERT_TRUE(rf.write(0x08, reinterpret_cast<hvuint8_t *>(&value), 4));
+    ASSERT_EQ(lastWrite, hvuint32_t(0x55u));
+
+    // Unregistered callback is no longer called
+    ASSERT_TRUE(rf.unregisterRangeCallback(postId));
+    ASSERT_FALSE(rf.unregisterRangeCallback(postId));
+    txn.setAddress(0x04);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(offsets.size(), std::size_t(4u));
+    ASSERT_FALSE(rf.hasRangeCallbacks(0x00));
+    ASSERT_TRUE(rf.hasRangeCallbacks(0x08));
+
+    // Range starting inside a register, overlapping two registers
+    std::vector<hvaddr_t> registerOffsets;
+    rf.registerRangeCallback(0x02, 0x05, RANGE_POST_READ, [&](const RangeAccessEvent &event) {
+        offsets.push_back(event.offset);
+        registerOffsets.push_back(event.registerOffset);
+        return true;
+    });
+    ASSERT_FALSE(rf.hasRangeCallbacks(0x00));
+    ASSERT_TRUE(rf.hasRangeCallbacks(0x00, 4));
+    offsets.clear();
+    txn.setAddress(0x00);
+    txn.setDataLength(8);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(offsets, std::vector<hvaddr_t>({0u, 2u}));
+    ASSERT_EQ(registerOffsets, std::vector<hvaddr_t>({2u, 0u}));
+    // Access not reaching range
+    txn.setDataLength(2);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(offsets.size(), std::size_t(2u));
+    ASSERT_TRUE(rf.read(0x00, reinterpret_cast<hvuint8_t *>(&value), 4));
+    ASSERT_EQ(registerOffsets.size(), std::size_t(3u));
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, RangeCallbackHierarchyTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    RegisterFile sub("Sub", "This is a sub-reg file", 4);
+    RegisterFile bank0("Bank0", "This is bank 0", 4);
+    RegisterFile bank1("Bank1", "This is bank 1", 4);
+    ASSERT_TRUE(sub.createRegister(0x0, 32, "SubReg0", "", RW));
+    ASSERT_TRUE(sub.createRegister(0x4, 32, "SubReg1", "", RW));
+    ASSERT_TRUE(bank0.createRegister(0x0, 32, "B0R0", "", RW));
+    ASSERT_TRUE(bank1.createRegister(0x0, 32, "B1R0", "", RW));
+    SomeRegModuleClass rm("RegModuleRangeCallbackHierarchy", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterFile &rf = rm.getMainRegFile();
+    ASSERT_TRUE(rf.addRegisterFile(0x10, sub));
+    ASSERT_TRUE(rf.addBankedWindow(0x20, {&bank0, &bank1}));
+
+    // Address is cached in decoder before callback registration
+    hvuint32_t data(0x11u);
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x14);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(&data));
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+
+    // Callbacks of inserted register file, with addresses relative to it
+    std::vector<hvaddr_t> addresses;
+    hvuint64_t revision(rf.getRevision());
+    hvcbID_t subId(sub.registerRangeCallback(0x4, 0x7, RANGE_POST_WRITE,
+                                             [&addresses](const RangeAccessEvent &event) {
+                                                 addresses.push_back(event.address);
+                                                 return true;
+                                             }));
+    ASSERT_GT(rf.getRevision(), revision);
+    ASSERT_TRUE(rf.hasRangeCallbacks(0x14));
+    ASSERT_FALSE(rf.hasRangeCallbacks(0x10));
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(addresses, std::vector<hvaddr_t>({0x4}));
+    ASSERT_TRUE(rf.write(0x14, reinterpret_cast<hvuint8_t *>(&data), 4));
+    ASSERT_EQ(addresses.size(), std::size_t(2u));
+
+    // Callbacks of active bank only
+    bank1.registerRangeCallback(0x0, 0x3, RANGE_PRE_WRITE,
+                                [](const RangeAccessEvent &) { return false; });
+    txn.setAddress(0x20);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_TRUE(rf.selectBank(0x20, 1));
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_GENERIC_ERROR_RESPONSE);
+    ASSERT_FALSE(rf.write(0x20, reinterpret_cast<hvuint8_t *>(&data), 4));
+    ASSERT_EQ(hvuint32_t(bank1.getRegister(0x0).getValue()), hvuint32_t(0x0u));
+
+    // Unregistration is seen by decoder as well
+    revision = rf.getRevision();
+    ASSERT_TRUE(sub.unregisterRangeCallback(subId));
+    ASSERT_GT(rf.getRevision(), revision);
+    txn.setAddress(0x14);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(addresses.size(), std::size_t(2u));
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, WriteCoalescingTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleCoalescing", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterFile &rf = rm.getMainRegFile();
+    std::vector<std::pair<hvuint32_t, hvuint32_t> > notifications;
+    hvuint32_t reg2AtReg0Notification(0u);
+    rf.getRegister(0x0).registerPostWriteCallback([&](const RegisterWriteEvent &ev) {
+        notifications.push_back(
+            std::make_pair(hvuint32_t(ev.oldValue), hvuint32_t(ev.newValue)));
+        reg2AtReg0Notification = hvuint32_t(rf.getRegister(0x8).getValue());
+    });
+
+    // Burst notifications are delivered at end of transaction
+    rm.setWriteCoalescing(SomeRegModuleClass::COALESCE_TRANSACTION);
+    hvuint32_t data[3] = {0x11u, 0x22u, 0x33u};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x00);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(data));
+    txn.setDataLength(12);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(notifications.size(), std::size_t(1u));
+    ASSERT_EQ(reg2AtReg0Notification, hvuint32_t(0x33u));
+    ASSERT_EQ(rm.getWriteCoalescer().howManyPending(), std::size_t(0u));
+
+    // Writes of a delta cycle are notified once with cumulative values
+    rm.setWriteCoalescing(SomeRegModuleClass::COALESCE_DELTA_CYCLE);
+    txn.setDataLength(4);
+    data[0] = 0x44u;
+    mod.socket->b_transport(txn, zeroTime);
+    data[0] = 0x55u;
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(notifications.size(), std::size_t(1u));
+    ASSERT_EQ(rm.getWriteCoalescer().howManyPending(), std::size_t(1u));
+    ASSERT_EQ(rm.getWriteCoalescer().getCoalescedWrites(), hvuint64_t(1u));
+    ::sc_core::sc_start();
+    ASSERT_EQ(notifications.size(), std::size_t(2u));
+    ASSERT_EQ(notifications[1].first, hvuint32_t(0x11u));
+    ASSERT_EQ(notifications[1].second, hvuint32_t(0x55u));
+
+    // Model batches, nested
+    PostWriteCoalescer &coalescer(rm.getWriteCoalescer());
+    coalescer.beginBatch();
+    coalescer.beginBatch();
+    hvuint32_t value(0x66u);
+    ASSERT_TRUE(rf.write(0x0, reinterpret_cast<hvuint8_t *>(&value), 4));
+    coalescer.endBatch();
+    ASSERT_EQ(notifications.size(), std::size_t(2u));
+    coalescer.endBatch();
+    ASSERT_EQ(notifications.size(), std::size_t(3u));
+
+    // Callback detaching a register pending later in the same round
+    Register &reg1(rf.getRegister(0x4));
+    std::size_t reg1Notifications(0u);
+    reg1.registerPostWriteCallback(
+        [&reg1Notifications](const RegisterWriteEvent &) { reg1Notifications++; });
+    hvcbID_t detachId(rf.getRegister(0x0).registerPostWriteCallback(
+        [&reg1](const RegisterWriteEvent &) { reg1.setPostWriteCoalescer(nullptr); }));
+    coalescer.beginBatch();
+    ASSERT_TRUE(rf.write(0x0, reinterpret_cast<hvuint8_t *>(&value), 4));
+    ASSERT_TRUE(rf.write(0x4, reinterpret_cast<hvuint8_t *>(&value), 4));
+    coalescer.endBatch();
+    ASSERT_EQ(notifications.size(), std::size_t(4u));
+    ASSERT_EQ(reg1Notifications, std::size_t(0u));
+    ASSERT_TRUE(rf.getRegister(0x0).unregisterPostWriteCallback(detachId));
+    reg1.setPostWriteCoalescer(&coalescer);
+
+    // No coalescing
+    rm.setWriteCoalescing(SomeRegModuleClass::COALESCE_NONE);
+    coalescer.beginBatch();
+    ASSERT_TRUE(rf.write(0x0, reinterpret_cast<hvuint8_t *>(&value), 4));
+    ASSERT_EQ(notifications.size(), std::size_t(5u));
+    coalescer.endBatch();
+}
+
+TEST_F(RegModuleTest, CoalescedBankSelectionTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    RegisterFile bank0("Bank0", "This is bank 0", 4);
+    RegisterFile bank1("Bank1", "This is bank 1", 4);
+    ASSERT_TRUE(bank0.createRegister(0x0, 32, "B0R0", "", RW));
+    ASSERT_TRUE(bank1.createRegister(0x0, 32, "B1R0", "", RW));
+    SomeRegModuleClass rm("RegModuleCoalescedBanks", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterFile &rf = rm.getMainRegFile();
+    ASSERT_TRUE(rf.addBankedWindow(0xC, {&bank0, &bank1}));
+    ASSERT_TRUE(rf.setBankSelector(0xC, rf.getRegister(0x0)));
+
+    // Selector and window written by one burst: bank switches before window
+    rm.setWriteCoalescing(SomeRegModuleClass::COALESCE_TRANSACTION);
+    hvuint32_t data[4] = {0x1u, 0x22u, 0x33u, 0x44u};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x00);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(data));
+    txn.setDataLength(16);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(rf.getActiveBank(0xC), std::size_t(1u));
+    ASSERT_EQ(hvuint32_t(bank1.getRegister(0x0).getValue()), hvuint32_t(0x44u));
+    ASSERT_EQ(hvuint32_t(bank0.getRegister(0x0).getValue()), hvuint32_t(0x0u));
+
+    // Same within a delta cycle batch
+    rm.setWriteCoalescing(SomeRegModuleClass::COALESCE_DELTA_CYCLE);
+    txn.setDataLength(4);
+    data[0] = 0x0u;
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_TRUE(rm.getWriteCoalescer().isBatching());
+    txn.setAddress(0x0C);
+    data[0] = 0x55u;
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(rf.getActiveBank(0xC), std::size_t(0u));
+    ASSERT_EQ(hvuint32_t(bank0.getRegister(0x0).getValue()), hvuint32_t(0x55u));
+    ASSERT_EQ(hvuint32_t(bank1.getRegister(0x0).getValue()), hvuint32_t(0x44u));
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, RegisterArrayTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleRegisterArray", 4, 32);
+    FooMMModule mod("MyFooModule");
+    mod.socket.bind(rm.memMapSocket);
+    RegisterArray descriptors(256, 32, "DESC", "Descriptors", RW);
+    ASSERT_TRUE(rm.addRegion(0xC, descriptors));
+
+    // Burst crossing last register and array
+    hvuint32_t data[4] = {0x11u, 0x22u, 0x33u, 0x44u};
+    MemoryMappedPayload<hvaddr_t> txn;
+    txn.setAddress(0x8);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(data));
+    txn.setDataLength(16);
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(hvuint32_t(rm.getMainRegFile().getRegister(0x8).getValue()), hvuint32_t(0x11u));
+    ASSERT_EQ(descriptors.getValue(0), hvuint64_t(0x22u));
+    ASSERT_EQ(descriptors.getValue(2), hvuint64_t(0x44u));
+
+    // Single-word read of last element
+    descriptors.setValue(255, 0xCAFEu);
+    hvuint32_t value(0u);
+    txn.setAddress(0x408);
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(&value));
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(value, hvuint32_t(0xCAFEu));
+
+    // Debug transport bypasses callbacks
+    descriptors.registerCallback(ARRAY_PRE_READ, [](const RegisterArrayEvent &) { return false; });
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_GENERIC_ERROR_RESPONSE);
+    value = 0u;
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 4u);
+    ASSERT_EQ(value, hvuint32_t(0xCAFEu));
+}
+
+TEST_F(RegModuleTest, SparseMemoryRegionTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    ::sc_core::sc_time zeroTime(::sc_core::SC_ZERO_TIME);
+
+    SomeRegModuleClass rm("RegModuleSparseMemory", 4, 32);
+    DmiInitiator mod("MyDmiInitiator");
+    mod.socket.bind(rm.memMapSocket);
+    SparseMemoryRegion mailbox(0x10000, "Mailbox");
+    ASSERT_TRUE(rm.addRegion(0x10000, mailbox));
+
+    // Read/write DMI is granted one page at a time
+    MemoryMappedPayload<hvaddr_t> txn;
+    ::tlm::tlm_dmi dmi;
+    txn.setAddress(0x11010);
+    ASSERT_TRUE(mod.socket->get_direct_mem_ptr(txn, dmi));
+    ASSERT_EQ(dmi.get_start_address(), ::sc_dt::uint64(0x11000));
+    ASSERT_EQ(dmi.get_end_address(), ::sc_dt::uint64(0x11FFF));
+    ASSERT_TRUE(dmi.is_read_allowed());
+    ASSERT_TRUE(dmi.is_write_allowed());
+    ASSERT_EQ(mailbox.getAllocatedPageCount(), std::size_t(1));
+    hvuint8_t *page = dmi.get_dmi_ptr();
+
+    // DMI and transport accesses share page storage
+    page[0x10] = 0x5A;
+    hvuint32_t data[2] = {0u, 0u};
+    txn.setDataPtr(reinterpret_cast<hvuint8_t *>(data));
+    txn.setDataLength(8);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(txn.getResponseStatus(), MEM_MAP_OK_RESPONSE);
+    ASSERT_EQ(data[0], hvuint32_t(0x5Au));
+    data[1] = 0xCAFEu;
+    txn.setCommand(MEM_MAP_WRITE_COMMAND);
+    mod.socket->b_transport(txn, zeroTime);
+    ASSERT_EQ(page[0x14], hvuint8_t(0xFE));
+    txn.setAddress(0x11014);
+    txn.setDataLength(4);
+    txn.setCommand(MEM_MAP_READ_COMMAND);
+    data[0] = 0u;
+    ASSERT_EQ(mod.socket->transport_dbg(txn), 4u);
+    ASSERT_EQ(data[0], hvuint32_t(0xCAFEu));
+
+    // Freeing pages invalidates their DMI pointers
+    SparseMemoryRegion::Snapshot snap(mailbox.takeSnapshot());
+    mailbox.clear();
+    ASSERT_EQ(mod.invalidations.size(), std::size_t(1));
+    ASSERT_EQ(mod.invalidations[0].first, ::sc_dt::uint64(0x11000));
+    ASSERT_EQ(mod.invalidations[0].second, ::sc_dt::uint64(0x11FFF));
+    ASSERT_TRUE(mailbox.restoreSnapshot(snap));
+    hvuint32_t value(0u);
+    mailbox.debugRead(0x1014, reinterpret_cast<hvuint8_t *>(&value), 4);
+    ASSERT_EQ(value, hvuint32_t(0xCAFEu));
+
+    ::sc_core::sc_start();
+}
+
+TEST_F(RegModuleTest, DirectMemoryListenerLifetimeTest) {
+    HV_SYSTEMC_RESET_CONTEXT
+    Register shared(32, "shared", "Register outliving module", RW);
+    SparseMemoryRegion buffer(0x1000, "Buffer");
+    {
+        RegModule<> rm("RegModuleShortLived");
+        DmiInitiator mod("MyDmiInitiator");
+        mod.socket.bind(rm.memMapSocket);
+        ASSERT_TRUE(rm.addRegister(0x0, shared));
+        ASSERT_TRUE(rm.addRegion(0x1000, buffer));
+        {
+            // Register destroyed before module is forgotten by module
+            Register local(32, "local", "Register destroyed first", RW);
+            ASSERT_TRUE(rm.addRegister(0x4, local));
+            MemoryMappedPayload<hvaddr_t> txn;
+            ::tlm::tlm_dmi dmi;
+            txn.setAddress(0x0);
+            ASSERT_TRUE(mod.socket->get_direct_mem_ptr(txn, dmi));
+            ASSERT_EQ(local.getListener(), &rm);
+        }
+        MemoryMappedPayload<hvaddr_t> txn;
+        ::tlm::tlm_dmi dmi;
+        txn.setAddress(0x1000);
+        ASSERT_TRUE(mod.socket->get_direct_mem_ptr(txn, dmi));
+        ASSERT_EQ(shared.getListener(), &rm);
+        ASSERT_EQ(buffer.getListener(), &rm);
+    }
+
+    // Module detached itself from register and region outliving it
+    ASSERT_EQ(shared.getListener(), nullptr);
+    ASSERT_EQ(buffer.getListener(), nullptr);
+    shared = hvuint32_t(0x1234u);
+    buffer.clear();
+}